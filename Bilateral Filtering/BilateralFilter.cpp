@@ -1,9 +1,101 @@
 #include "BilateralFilter.h"
+#include "BilateralGrid.h"
+#include "BilateralKernel.h"
+#include "Lightness.h"
 #include <opencv2/opencv.hpp>
+#include <algorithm>
 #include <cmath>
+#include <vector>
+
+#include "imgs/ipcv/parallel/TileExecutor.h"
+
+using namespace std;
 
 namespace ipcv {
 
+// Number of rows converted back to BGR at a time by the grid method
+static const int kStripRows = 64;
+
+/** Bilateral filter a single-channel plane, handing the filtered result to
+ *  a sink one tile at a time
+ *
+ *  The plane is split into tiles run in parallel on the shared
+ *  TileExecutor, which gives every tile a halo of width radius
+ *  (extrapolated past the image edges), so every row of a tile goes
+ *  through the vectorized row kernel.  Apart from the plane itself, memory
+ *  use is limited to one tile of filtered pixels per worker.
+ *
+ *  \param[in] plane           source cv::Mat of single-channel type T
+ *  \param[in] sigma_distance  standard deviation of distance/closeness filter
+ *  \param[in] sigma_range     standard deviation of range/similarity filter
+ *  \param[in] radius          radius of the bilateral filter (if negative, use
+ *                             twice the standard deviation of the distance/
+ *                             closeness filter)
+ *  \param[in] border_mode     pixel extrapolation method
+ *  \param[in] border_level    plane value to use for constant border mode
+ *  \param[in] sink            called as sink(tile, rect) with each CV_32FC1
+ *                             tile of filtered pixels and its place in the
+ *                             plane (from several threads, for disjoint
+ *                             rects)
+ */
+template <typename T, typename Sink>
+static void FilterPlane(const cv::Mat& plane, const double sigma_distance,
+                        const double sigma_range, const int radius,
+                        const BorderMode border_mode, const float border_level,
+                        Sink sink) {
+  int new_radius =
+      (radius <= 0) ? static_cast<int>(2 * sigma_distance) : radius;
+
+  // Prepare the closeness kernel (spatial Gaussian)
+  const int width = 2 * new_radius + 1;
+  vector<float> closeness_kernel(width * width);
+  for (int row = -new_radius; row <= new_radius; row++) {
+    for (int col = -new_radius; col <= new_radius; col++) {
+      closeness_kernel[(row + new_radius) * width + col + new_radius] =
+          std::exp(-0.5 * ((row * row + col * col) /
+                           (sigma_distance * sigma_distance)));
+    }
+  }
+
+  // Prepare the range kernel (similarity Gaussian) lookup table
+  double min_value, max_value;
+  cv::minMaxLoc(plane, &min_value, &max_value);
+  if (border_mode == BorderMode::CONSTANT) {
+    min_value = std::min(min_value, static_cast<double>(border_level));
+    max_value = std::max(max_value, static_cast<double>(border_level));
+  }
+  RangeKernelTable range_table;
+  MakeRangeKernelTable(sigma_range, max_value - min_value, range_table);
+
+  // Apply bilateral filter a tile at a time, then hand the tile over
+  TileHalo halo;
+  halo.top = halo.bottom = halo.left = halo.right = new_radius;
+  TileBorder border;
+  if (border_mode == BorderMode::CONSTANT) {
+    border.type = cv::BORDER_CONSTANT;
+    border.value = cv::Scalar::all(border_level);
+  }
+
+  TileExecutor& executor = SharedTileExecutor();
+  vector<cv::Mat> filtered(executor.Threads());
+  executor.Run(
+      plane, halo, border,
+      [&](const cv::Mat& tile, const cv::Rect& rect, int worker) {
+        cv::Mat& dst_tile = filtered[worker];
+        dst_tile.create(rect.size(), CV_32FC1);
+        const ptrdiff_t stride = tile.step / sizeof(T);
+
+        for (int row_idx = 0; row_idx < rect.height; row_idx++) {
+          BilateralFilterRow(tile.ptr<T>(row_idx + new_radius) + new_radius,
+                             stride, rect.width, new_radius,
+                             closeness_kernel.data(), range_table,
+                             dst_tile.ptr<float>(row_idx));
+        }
+
+        sink(dst_tile, rect);
+      });
+}
+
 /** Bilateral filter an image
  *
  *  \param[in] src             source cv::Mat of CV_8UC3
@@ -20,79 +112,226 @@ bool BilateralFilter(const cv::Mat& src, cv::Mat& dst,
                      const double sigma_distance, const double sigma_range,
                      const int radius, const BorderMode border_mode,
                      uint8_t border_value) {
+  // Single-channel images are filtered on their intensity directly
+  switch (src.type()) {
+    case CV_8UC1:
+      return BilateralFilterPlane<uchar>(src, dst, sigma_distance,
+                                         sigma_range, radius, border_mode,
+                                         border_value);
+    case CV_16UC1:
+      return BilateralFilterPlane<ushort>(src, dst, sigma_distance,
+                                          sigma_range, radius, border_mode,
+                                          border_value);
+    case CV_32FC1:
+      return BilateralFilterPlane<float>(src, dst, sigma_distance,
+                                         sigma_range, radius, border_mode,
+                                         border_value);
+    case CV_8UC3:
+      break;
+    default:
+      return false;
+  }
+
   // Set up dst with the same size and type as src
   dst.create(src.size(), src.type());
 
-  float filtered_value, weight_sum;
+  // Only the lightness is filtered
+  cv::Mat src_l;
+  LightnessPlane(src, src_l);
 
-  int new_radius =
-      (radius <= 0) ? static_cast<int>(2 * sigma_distance) : radius;
+  // Lightness of the background color for the constant border mode
+  cv::Mat border_bgr(1, 1, CV_32FC3, cv::Scalar::all(border_value / 255.0));
+  cv::Mat border_lab;
+  cv::cvtColor(border_bgr, border_lab, cv::COLOR_BGR2Lab);
+  const float border_l = border_lab.at<cv::Vec3f>(0, 0)[0];
 
-  cv::Mat src_border, src_lab, dst_lab = cv::Mat::zeros(src.size(), CV_32FC3);
+  // Convert each filtered tile back to BGR color space and set the output
+  FilterPlane<float>(src_l, sigma_distance, sigma_range, radius, border_mode,
+                     border_l, [&](const cv::Mat& tile, const cv::Rect& rect) {
+                       cv::Mat dst_tile = dst(rect);
+                       ReplaceLightness(src(rect), tile, 0, dst_tile);
+                     });
 
-  // Expand the border to handle edges
-  cv::copyMakeBorder(src, src_border, new_radius, new_radius, new_radius,
-                     new_radius, cv::BORDER_CONSTANT,
-                     cv::Scalar(border_value, border_value, border_value));
+  return true;
+}
 
-  src_border.convertTo(src_border, CV_32FC3, 1 / 255.0);
-  cv::cvtColor(src_border, src_lab, cv::COLOR_BGR2Lab);
+/** Bilateral filter a single-channel intensity plane directly
+ *
+ *  \param[in] src             source cv::Mat of single-channel type T
+ *  \param[out] dst            destination cv::Mat of the same type as src
+ *  \param[in] sigma_distance  standard deviation of distance/closeness filter
+ *  \param[in] sigma_range     standard deviation of range/similarity filter,
+ *                             in the units of the source samples
+ *  \param[in] radius          radius of the bilateral filter (if negative, use
+ *                             twice the standard deviation of the distance/
+ *                             closeness filter)
+ *  \param[in] border_mode     pixel extrapolation method
+ *  \param[in] border_value    value to use for constant border mode
+ */
+template <typename T>
+bool BilateralFilterPlane(const cv::Mat& src, cv::Mat& dst,
+                          const double sigma_distance,
+                          const double sigma_range, const int radius,
+                          const BorderMode border_mode, const T border_value) {
+  if (src.channels() != 1 || src.elemSize() != sizeof(T)) {
+    return false;
+  }
 
-  // Prepare the closeness kernel (spatial Gaussian)
-  cv::Mat closeness_kernel(2 * new_radius + 1, 2 * new_radius + 1, CV_32F);
-  for (int row = -new_radius; row <= new_radius; row++) {
-    for (int col = -new_radius; col <= new_radius; col++) {
-      closeness_kernel.at<float>(row + new_radius, col + new_radius) = std::exp(
-          -0.5 * ((row * row + col * col) / (sigma_distance * sigma_distance)));
-    }
+  // Filtered rows are written while later rows are still being read, so
+  // filtering in place needs a copy of the source
+  const cv::Mat plane = (src.data == dst.data) ? src.clone() : src;
+  dst.create(plane.size(), plane.type());
+
+  FilterPlane<T>(plane, sigma_distance, sigma_range, radius, border_mode,
+                 static_cast<float>(border_value),
+                 [&](const cv::Mat& tile, const cv::Rect& rect) {
+                   cv::Mat dst_tile = dst(rect);
+                   tile.convertTo(dst_tile, dst.type());
+                 });
+
+  return true;
+}
+
+template bool BilateralFilterPlane<uchar>(const cv::Mat&, cv::Mat&,
+                                          const double, const double,
+                                          const int, const BorderMode,
+                                          const uchar);
+template bool BilateralFilterPlane<ushort>(const cv::Mat&, cv::Mat&,
+                                           const double, const double,
+                                           const int, const BorderMode,
+                                           const ushort);
+template bool BilateralFilterPlane<float>(const cv::Mat&, cv::Mat&,
+                                          const double, const double,
+                                          const int, const BorderMode,
+                                          const float);
+
+/** Bilateral filter a color image using a precomputed luminance plane
+ *
+ *  \param[in] src             source cv::Mat of CV_8UC3
+ *  \param[in] luminance       luminance of src, cv::Mat of CV_8UC1 or
+ *                             CV_32FC1 on the same [0, 255] scale as src
+ *  \param[out] dst            destination cv::Mat of CV_8UC3
+ *  \param[in] sigma_distance  standard deviation of distance/closeness filter
+ *  \param[in] sigma_range     standard deviation of range/similarity filter,
+ *                             in luminance units
+ *  \param[in] radius          radius of the bilateral filter (if negative, use
+ *                             twice the standard deviation of the distance/
+ *                             closeness filter)
+ *  \param[in] border_mode     pixel extrapolation method
+ *  \param[in] border_value    value to use for constant border mode
+ */
+bool BilateralFilterLuminance(const cv::Mat& src, const cv::Mat& luminance,
+                              cv::Mat& dst, const double sigma_distance,
+                              const double sigma_range, const int radius,
+                              const BorderMode border_mode,
+                              uint8_t border_value) {
+  if (src.type() != CV_8UC3 || luminance.size() != src.size()) {
+    return false;
   }
 
-  // Apply bilateral filter
-  for (int row_idx = new_radius; row_idx < src_lab.rows - new_radius;
-       row_idx++) {
-    for (int col_idx = new_radius; col_idx < src_lab.cols - new_radius;
-         col_idx++) {
-      filtered_value = 0.0f;
-      weight_sum = 0.0f;
-
-      for (int dy = -new_radius; dy <= new_radius; dy++) {
-        for (int dx = -new_radius; dx <= new_radius; dx++) {
-          filtered_value +=
-              closeness_kernel.at<float>(dy + new_radius, dx + new_radius) *
-              std::exp(
-                  -0.5 *
-                  ((src_lab.at<cv::Vec3f>(row_idx, col_idx)[0] -
-                    src_lab.at<cv::Vec3f>(row_idx + dy, col_idx + dx)[0]) *
-                   (src_lab.at<cv::Vec3f>(row_idx, col_idx)[0] -
-                    src_lab.at<cv::Vec3f>(row_idx + dy, col_idx + dx)[0])) /
-                  (sigma_range * sigma_range)) *
-              src_lab.at<cv::Vec3f>(row_idx + dy, col_idx + dx)[0];
-
-          weight_sum +=
-              closeness_kernel.at<float>(dy + new_radius, dx + new_radius) *
-              std::exp(
-                  -0.5 *
-                  ((src_lab.at<cv::Vec3f>(row_idx, col_idx)[0] -
-                    src_lab.at<cv::Vec3f>(row_idx + dy, col_idx + dx)[0]) *
-                   (src_lab.at<cv::Vec3f>(row_idx, col_idx)[0] -
-                    src_lab.at<cv::Vec3f>(row_idx + dy, col_idx + dx)[0])) /
-                  (sigma_range * sigma_range));
+  dst.create(src.size(), src.type());
+
+  // Add the change in luminance to every color channel of the tile
+  auto apply_tile = [&](const cv::Mat& tile, const cv::Rect& rect) {
+    cv::Mat tile_luminance;
+    luminance(rect).convertTo(tile_luminance, CV_32F);
+
+    for (int tile_idx = 0; tile_idx < tile.rows; tile_idx++) {
+      const float* filtered_row = tile.ptr<float>(tile_idx);
+      const float* luminance_row = tile_luminance.ptr<float>(tile_idx);
+      const uchar* src_row = src.ptr<uchar>(rect.y + tile_idx) + 3 * rect.x;
+      uchar* dst_row = dst.ptr<uchar>(rect.y + tile_idx) + 3 * rect.x;
+
+      for (int col_idx = 0; col_idx < rect.width; col_idx++) {
+        const float delta = filtered_row[col_idx] - luminance_row[col_idx];
+        for (int channel_idx = 0; channel_idx < 3; channel_idx++) {
+          dst_row[3 * col_idx + channel_idx] = cv::saturate_cast<uchar>(
+              src_row[3 * col_idx + channel_idx] + delta);
         }
       }
+    }
+  };
 
-      // Normalize and assign to dst
-      dst_lab.at<cv::Vec3f>(row_idx - new_radius, col_idx - new_radius)[0] =
-          filtered_value / weight_sum;
-      dst_lab.at<cv::Vec3f>(row_idx - new_radius, col_idx - new_radius)[1] =
-          src_lab.at<cv::Vec3f>(row_idx, col_idx)[1];
-      dst_lab.at<cv::Vec3f>(row_idx - new_radius, col_idx - new_radius)[2] =
-          src_lab.at<cv::Vec3f>(row_idx, col_idx)[2];
+  switch (luminance.type()) {
+    case CV_8UC1:
+      FilterPlane<uchar>(luminance, sigma_distance, sigma_range, radius,
+                         border_mode, border_value, apply_tile);
+      return true;
+    case CV_32FC1:
+      FilterPlane<float>(luminance, sigma_distance, sigma_range, radius,
+                         border_mode, border_value, apply_tile);
+      return true;
+    default:
+      return false;
+  }
+}
+
+/** Bilateral filter an image using the provided evaluation options
+ *
+ *  \param[in] src             source cv::Mat of CV_8UC3
+ *  \param[out] dst            destination cv::Mat of ddepth type
+ *  \param[in] sigma_distance  standard deviation of distance/closeness filter
+ *  \param[in] sigma_range     standard deviation of range/similarity filter
+ *  \param[in] radius          radius of the bilateral filter (if negative, use
+ *                             twice the standard deviation of the distance/
+ *                             closeness filter); ignored by the grid method
+ *  \param[in] border_mode     pixel extrapolation method; ignored by the grid
+ *                             method, for which pixels outside of the image
+ *                             do not contribute
+ *  \param[in] border_value    value to use for constant border mode
+ *  \param[in] options         evaluation method and accuracy settings (the
+ *                             exact method is used instead of the grid when
+ *                             the image range does not fit in the grid, see
+ *                             BilateralGridFits)
+ */
+bool BilateralFilter(const cv::Mat& src, cv::Mat& dst,
+                     const double sigma_distance, const double sigma_range,
+                     const int radius, const BorderMode border_mode,
+                     uint8_t border_value, const BilateralOptions& options) {
+  if (options.method == BilateralMethod::EXACT) {
+    return BilateralFilter(src, dst, sigma_distance, sigma_range, radius,
+                           border_mode, border_value);
+  }
+
+  // Single-channel images are gridded on their intensity directly
+  if (src.type() == CV_8UC1 || src.type() == CV_16UC1 ||
+      src.type() == CV_32FC1) {
+    cv::Mat src_float, dst_float;
+    src.convertTo(src_float, CV_32F);
+    if (!BilateralGridFits(src_float, sigma_range, options.grid_accuracy)) {
+      return BilateralFilter(src, dst, sigma_distance, sigma_range, radius,
+                             border_mode, border_value);
+    }
+    if (!BilateralGrid(src_float, dst_float, sigma_distance, sigma_range,
+                       options.grid_accuracy)) {
+      return false;
     }
+    dst_float.convertTo(dst, src.type());
+    return true;
+  } else if (src.type() != CV_8UC3) {
+    return false;
   }
 
+  // Filter the lightness channel on the grid, leaving a and b untouched
+  cv::Mat src_l, dst_l;
+  LightnessPlane(src, src_l);
+  if (!BilateralGridFits(src_l, sigma_range, options.grid_accuracy)) {
+    return BilateralFilter(src, dst, sigma_distance, sigma_range, radius,
+                           border_mode, border_value);
+  }
+  if (!BilateralGrid(src_l, dst_l, sigma_distance, sigma_range,
+                     options.grid_accuracy)) {
+    return false;
+  }
+  src_l.release();
+
   // Convert back to BGR color space and set the output
-  cv::cvtColor(dst_lab, dst, cv::COLOR_Lab2BGR);
-  dst.convertTo(dst, CV_8UC3, 255);
+  dst.create(src.size(), src.type());
+  for (int first_row = 0; first_row < src.rows; first_row += kStripRows) {
+    const int strip_rows = std::min(kStripRows, src.rows - first_row);
+    ReplaceLightness(src, dst_l.rowRange(first_row, first_row + strip_rows),
+                     first_row, dst);
+  }
 
   return true;
 }
@@ -19,7 +19,31 @@ enum class BorderMode {
   REPLICATE  // Replicate border pixels
 };
 
+// Available bilateral filtering methods
+enum class BilateralMethod {
+  EXACT,  // Brute-force evaluation over the full (2r+1)x(2r+1) window
+  GRID    // Bilateral grid approximation (cost independent of the radius)
+};
+
+/** Options controlling how the bilateral filter is evaluated
+ *
+ *  \var method         evaluation method
+ *  \var grid_accuracy  number of grid cells per standard deviation in each
+ *                      of the (x, y, L) grid dimensions when using the
+ *                      bilateral grid; larger values give a finer grid (more
+ *                      accurate, slower), smaller values a coarser grid
+ *                      [default is 1]
+ */
+struct BilateralOptions {
+  BilateralMethod method = BilateralMethod::EXACT;
+  double grid_accuracy = 1.0;
+};
+
 /** Bilateral filter an image
+ *
+ *  Color (CV_8UC3) images are filtered on the lightness of their Lab
+ *  representation; single-channel images (CV_8UC1, CV_16UC1, CV_32FC1) are
+ *  filtered on their intensity directly (see BilateralFilterPlane).
  *
  *  \param[in] src             source cv::Mat of CV_8UC3
  *  \param[out] dst            destination cv::Mat of ddepth type
@@ -36,4 +60,74 @@ bool BilateralFilter(const cv::Mat& src, cv::Mat& dst,
                      const int radius,
                      const BorderMode border_mode = BorderMode::REPLICATE,
                      uint8_t border_value = 0);
+
+/** Bilateral filter an image using the provided evaluation options
+ *
+ *  \param[in] src             source cv::Mat of CV_8UC3
+ *  \param[out] dst            destination cv::Mat of ddepth type
+ *  \param[in] sigma_distance  standard deviation of distance/closeness filter
+ *  \param[in] sigma_range     standard deviation of range/similarity filter
+ *  \param[in] radius          radius of the bilateral filter (if negative, use
+ *                             twice the standard deviation of the distance/
+ *                             closeness filter); ignored by the grid method
+ *  \param[in] border_mode     pixel extrapolation method; ignored by the grid
+ *                             method, for which pixels outside of the image
+ *                             do not contribute
+ *  \param[in] border_value    value to use for constant border mode
+ *  \param[in] options         evaluation method and accuracy settings (the
+ *                             exact method is used instead of the grid when
+ *                             the image range does not fit in the grid, see
+ *                             BilateralGridFits)
+ */
+bool BilateralFilter(const cv::Mat& src, cv::Mat& dst,
+                     const double sigma_distance, const double sigma_range,
+                     const int radius, const BorderMode border_mode,
+                     uint8_t border_value, const BilateralOptions& options);
+
+/** Bilateral filter a single-channel intensity plane directly, without any
+ *  color conversion (instantiated for uchar, ushort and float, i.e. CV_8UC1,
+ *  CV_16UC1 and CV_32FC1)
+ *
+ *  \param[in] src             source cv::Mat of single-channel type T
+ *  \param[out] dst            destination cv::Mat of the same type as src
+ *  \param[in] sigma_distance  standard deviation of distance/closeness filter
+ *  \param[in] sigma_range     standard deviation of range/similarity filter,
+ *                             in the units of the source samples
+ *  \param[in] radius          radius of the bilateral filter (if negative, use
+ *                             twice the standard deviation of the distance/
+ *                             closeness filter)
+ *  \param[in] border_mode     pixel extrapolation method
+ *  \param[in] border_value    value to use for constant border mode
+ */
+template <typename T>
+bool BilateralFilterPlane(const cv::Mat& src, cv::Mat& dst,
+                          const double sigma_distance,
+                          const double sigma_range, const int radius,
+                          const BorderMode border_mode = BorderMode::REPLICATE,
+                          const T border_value = 0);
+
+/** Bilateral filter a color image using a precomputed luminance plane
+ *
+ *  The luminance is filtered and the change in luminance is added to every
+ *  color channel, which leaves the chroma of a luminance/chroma (e.g.
+ *  YCbCr) representation untouched without any color conversion.
+ *
+ *  \param[in] src             source cv::Mat of CV_8UC3
+ *  \param[in] luminance       luminance of src, cv::Mat of CV_8UC1 or
+ *                             CV_32FC1 on the same [0, 255] scale as src
+ *  \param[out] dst            destination cv::Mat of CV_8UC3
+ *  \param[in] sigma_distance  standard deviation of distance/closeness filter
+ *  \param[in] sigma_range     standard deviation of range/similarity filter,
+ *                             in luminance units
+ *  \param[in] radius          radius of the bilateral filter (if negative, use
+ *                             twice the standard deviation of the distance/
+ *                             closeness filter)
+ *  \param[in] border_mode     pixel extrapolation method
+ *  \param[in] border_value    value to use for constant border mode
+ */
+bool BilateralFilterLuminance(
+    const cv::Mat& src, const cv::Mat& luminance, cv::Mat& dst,
+    const double sigma_distance, const double sigma_range, const int radius,
+    const BorderMode border_mode = BorderMode::REPLICATE,
+    uint8_t border_value = 0);
 }
@@ -0,0 +1,219 @@
+/** Implementation file for bilateral grid filtering
+ *
+ *  \file ipcv/bilateral_filtering/BilateralGrid.cpp
+ *  \author Anthony Guarino (ag4933@rit.edu)
+ *  \date 16 Oct 2026
+ */
+
+#include "BilateralGrid.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using namespace std;
+
+namespace ipcv {
+
+// Largest number of range cells a grid is allowed (before padding), which
+// keeps the grid of a plane of a few megapixels within about a gigabyte
+static const int kMaxGridDepth = 512;
+
+/** Number of range cells (before padding) of the grid of a value range
+ *
+ *  \param[in] min_value   smallest value of the plane
+ *  \param[in] max_value   largest value of the plane
+ *  \param[in] range_step  grid cell size in range units
+ */
+static double GridDepth(const double min_value, const double max_value,
+                        const double range_step) {
+  return std::floor((max_value - min_value) / range_step) + 1;
+}
+
+/** Blur one axis of an interleaved (value, weight) grid in place
+ *
+ *  \param[in,out] grid    grid data, two floats per cell
+ *  \param[in,out] buffer  scratch buffer of the same size as grid
+ *  \param[in] kernel      1D Gaussian kernel of length 2 * radius + 1
+ *  \param[in] count       number of cells along the blurred axis
+ *  \param[in] stride      distance (in cells) between neighbours on the axis
+ */
+static void BlurGridAxis(vector<float>& grid, vector<float>& buffer,
+                         const vector<float>& kernel, const int count,
+                         const size_t stride) {
+  const int radius = static_cast<int>(kernel.size()) / 2;
+  const size_t cells = grid.size() / 2;
+
+  for (size_t cell = 0; cell < cells; cell++) {
+    // Position of this cell along the blurred axis
+    const int position = static_cast<int>((cell / stride) % count);
+
+    float value = 0.0f;
+    float weight = 0.0f;
+    for (int k = -radius; k <= radius; k++) {
+      const int neighbour = position + k;
+      if (neighbour < 0 || neighbour >= count) {
+        continue;
+      }
+      const size_t offset = 2 * (cell + k * static_cast<ptrdiff_t>(stride));
+      value += kernel[k + radius] * grid[offset];
+      weight += kernel[k + radius] * grid[offset + 1];
+    }
+    buffer[2 * cell] = value;
+    buffer[2 * cell + 1] = weight;
+  }
+
+  grid.swap(buffer);
+}
+
+/** Gaussian kernel of a standard deviation (in cells), truncated at a radius
+ *
+ *  \param[in] sigma   standard deviation in cells
+ *  \param[in] radius  half length of the kernel in cells
+ */
+static vector<float> GridKernel(const double sigma, const int radius) {
+  vector<float> kernel(2 * radius + 1);
+  for (int k = -radius; k <= radius; k++) {
+    kernel[k + radius] =
+        static_cast<float>(std::exp(-0.5 * (k * k) / (sigma * sigma)));
+  }
+  return kernel;
+}
+
+/** Approximate bilateral filter of a single-channel plane using a bilateral
+ *  grid
+ *
+ *  \param[in] src             source cv::Mat of CV_32FC1
+ *  \param[out] dst            destination cv::Mat of CV_32FC1
+ *  \param[in] sigma_distance  standard deviation of distance/closeness filter
+ *  \param[in] sigma_range     standard deviation of range/similarity filter
+ *  \param[in] accuracy        number of grid cells per standard deviation
+ *                             along each grid dimension (spatial cells are
+ *                             never smaller than a pixel)
+ */
+bool BilateralGrid(const cv::Mat& src, cv::Mat& dst,
+                   const double sigma_distance, const double sigma_range,
+                   const double accuracy) {
+  if (src.type() != CV_32FC1 || accuracy <= 0 || sigma_distance <= 0 ||
+      sigma_range <= 0) {
+    return false;
+  }
+
+  // Grid cell sizes in pixels and in range units (a cell smaller than a
+  // pixel only wastes memory)
+  const double spatial_step = std::max(sigma_distance / accuracy, 1.0);
+  const double range_step = sigma_range / accuracy;
+
+  double min_value, max_value;
+  cv::minMaxLoc(src, &min_value, &max_value);
+  if (GridDepth(min_value, max_value, range_step) > kMaxGridDepth) {
+    return false;
+  }
+
+  // The grid is blurred with Gaussians of standard deviation sigma_distance
+  // (in spatial cells, fewer than "accuracy" once a cell is clamped to a
+  // pixel) and sigma_range ("accuracy" range cells), truncated at twice the
+  // standard deviation like the exact filter
+  const double spatial_sigma = sigma_distance / spatial_step;
+  const int spatial_radius = static_cast<int>(std::ceil(2 * spatial_sigma));
+  const int range_radius = static_cast<int>(std::ceil(2 * accuracy));
+  const int padding = std::max(spatial_radius, range_radius) + 1;
+
+  const int grid_cols =
+      static_cast<int>((src.cols - 1) / spatial_step) + 1 + 2 * padding;
+  const int grid_rows =
+      static_cast<int>((src.rows - 1) / spatial_step) + 1 + 2 * padding;
+  const int grid_depth =
+      static_cast<int>(GridDepth(min_value, max_value, range_step)) +
+      2 * padding;
+
+  // Cells are stored with the range dimension varying fastest, each holding
+  // the (weighted value, weight) pair
+  const size_t cells = static_cast<size_t>(grid_rows) * grid_cols * grid_depth;
+  vector<float> grid(2 * cells, 0.0f);
+  vector<float> buffer(2 * cells);
+
+  auto cell_index = [&](int x, int y, int z) {
+    return (static_cast<size_t>(y) * grid_cols + x) * grid_depth + z;
+  };
+
+  // Splat every pixel into its nearest grid cell
+  for (int row = 0; row < src.rows; row++) {
+    const float* src_row = src.ptr<float>(row);
+    const int y = static_cast<int>(row / spatial_step + 0.5) + padding;
+    for (int col = 0; col < src.cols; col++) {
+      const int x = static_cast<int>(col / spatial_step + 0.5) + padding;
+      const int z =
+          static_cast<int>((src_row[col] - min_value) / range_step + 0.5) +
+          padding;
+      const size_t idx = cell_index(x, y, z);
+      grid[2 * idx] += src_row[col];
+      grid[2 * idx + 1] += 1.0f;
+    }
+  }
+
+  // Blur the grid separably along each of its three dimensions
+  const vector<float> spatial_kernel =
+      GridKernel(spatial_sigma, spatial_radius);
+  const vector<float> range_kernel = GridKernel(accuracy, range_radius);
+  BlurGridAxis(grid, buffer, range_kernel, grid_depth, 1);
+  BlurGridAxis(grid, buffer, spatial_kernel, grid_cols, grid_depth);
+  BlurGridAxis(grid, buffer, spatial_kernel, grid_rows,
+               static_cast<size_t>(grid_cols) * grid_depth);
+
+  // Slice the grid at every pixel using trilinear interpolation
+  dst.create(src.size(), CV_32FC1);
+  for (int row = 0; row < src.rows; row++) {
+    const float* src_row = src.ptr<float>(row);
+    float* dst_row = dst.ptr<float>(row);
+
+    const double gy = row / spatial_step + padding;
+    const int y0 = static_cast<int>(gy);
+    const float fy = static_cast<float>(gy - y0);
+
+    for (int col = 0; col < src.cols; col++) {
+      const double gx = col / spatial_step + padding;
+      const double gz = (src_row[col] - min_value) / range_step + padding;
+      const int x0 = static_cast<int>(gx);
+      const int z0 = static_cast<int>(gz);
+      const float fx = static_cast<float>(gx - x0);
+      const float fz = static_cast<float>(gz - z0);
+
+      float value = 0.0f;
+      float weight = 0.0f;
+      for (int dy = 0; dy <= 1; dy++) {
+        const float wy = dy ? fy : 1.0f - fy;
+        for (int dx = 0; dx <= 1; dx++) {
+          const float wxy = wy * (dx ? fx : 1.0f - fx);
+          const size_t idx = cell_index(x0 + dx, y0 + dy, z0);
+          value += wxy * ((1.0f - fz) * grid[2 * idx] + fz * grid[2 * idx + 2]);
+          weight +=
+              wxy * ((1.0f - fz) * grid[2 * idx + 1] + fz * grid[2 * idx + 3]);
+        }
+      }
+
+      dst_row[col] = (weight > 0.0f) ? value / weight : src_row[col];
+    }
+  }
+
+  return true;
+}
+
+/** Whether the range of a plane fits in the range cells of a bilateral grid
+ *
+ *  \param[in] src          source cv::Mat of CV_32FC1
+ *  \param[in] sigma_range  standard deviation of range/similarity filter
+ *  \param[in] accuracy     number of grid cells per standard deviation
+ */
+bool BilateralGridFits(const cv::Mat& src, const double sigma_range,
+                       const double accuracy) {
+  if (src.type() != CV_32FC1 || accuracy <= 0 || sigma_range <= 0) {
+    return false;
+  }
+
+  double min_value, max_value;
+  cv::minMaxLoc(src, &min_value, &max_value);
+  return GridDepth(min_value, max_value, sigma_range / accuracy) <=
+         kMaxGridDepth;
+}
+}
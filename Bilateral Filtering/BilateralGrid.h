@@ -0,0 +1,46 @@
+/** Interface file for bilateral grid filtering
+ *
+ *  \file ipcv/bilateral_filtering/BilateralGrid.h
+ *  \author Anthony Guarino (ag4933@rit.edu)
+ *  \date 16 Oct 2026
+ */
+
+#pragma once
+
+#include <opencv2/core.hpp>
+
+namespace ipcv {
+
+/** Approximate bilateral filter of a single-channel plane using a bilateral
+ *  grid (splat into a downsampled (x, y, value) grid, blur the grid, and
+ *  slice it back at every pixel)
+ *
+ *  The cost is linear in the number of pixels and independent of the
+ *  spatial standard deviation.  Pixels outside of the image do not
+ *  contribute to the result (there is no border mode).  Planes whose range
+ *  needs more range cells than BilateralGridFits allows are rejected.
+ *
+ *  \param[in] src             source cv::Mat of CV_32FC1
+ *  \param[out] dst            destination cv::Mat of CV_32FC1
+ *  \param[in] sigma_distance  standard deviation of distance/closeness filter
+ *  \param[in] sigma_range     standard deviation of range/similarity filter
+ *  \param[in] accuracy        number of grid cells per standard deviation
+ *                             along each grid dimension (spatial cells are
+ *                             never smaller than a pixel)
+ */
+bool BilateralGrid(const cv::Mat& src, cv::Mat& dst,
+                   const double sigma_distance, const double sigma_range,
+                   const double accuracy = 1.0);
+
+/** Whether the range of a plane fits in the range cells of a bilateral grid
+ *  (the grid memory grows with the range of the plane over the range
+ *  standard deviation, e.g. a 16-bit plane with a small range standard
+ *  deviation does not fit)
+ *
+ *  \param[in] src          source cv::Mat of CV_32FC1
+ *  \param[in] sigma_range  standard deviation of range/similarity filter
+ *  \param[in] accuracy     number of grid cells per standard deviation
+ */
+bool BilateralGridFits(const cv::Mat& src, const double sigma_range,
+                       const double accuracy = 1.0);
+}
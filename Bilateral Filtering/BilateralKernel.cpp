@@ -0,0 +1,418 @@
+/** Implementation file for the vectorized bilateral filter row kernel
+ *
+ *  \file ipcv/bilateral_filtering/BilateralKernel.cpp
+ *  \author Anthony Guarino (ag4933@rit.edu)
+ *  \date 16 Oct 2026
+ */
+
+#include "BilateralKernel.h"
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define IPCV_BILATERAL_X86 1
+#include <immintrin.h>
+#endif
+
+using namespace std;
+
+namespace ipcv {
+
+// Arguments shared by every row kernel implementation
+template <typename T>
+using RowKernel = void (*)(const T*, ptrdiff_t, int, int, const float*,
+                           const float*, int, float, float*);
+using AccumulateKernel = void (*)(const float*, ptrdiff_t, const float*, int,
+                                  int, const float*, const float*, int, float,
+                                  float*, float*);
+
+/** Tabulate the range kernel
+ *
+ *  \param[in] sigma_range      standard deviation of range/similarity filter
+ *  \param[in] max_difference   largest absolute difference to be looked up
+ *  \param[out] table           tabulated range kernel
+ */
+void MakeRangeKernelTable(const double sigma_range, const double max_difference,
+                          RangeKernelTable& table) {
+  table.scale = static_cast<float>(256.0 / sigma_range);
+
+  const double max_tabulated = std::min(max_difference, 12 * sigma_range);
+  const int size =
+      static_cast<int>(std::ceil(max_tabulated * table.scale)) + 2;
+  table.weights.resize(size);
+  for (int i = 0; i < size; i++) {
+    const double difference = i / static_cast<double>(table.scale);
+    const double weight = std::exp(-0.5 * (difference * difference) /
+                                   (sigma_range * sigma_range));
+
+    // Flush negligible weights to zero so the products never go denormal
+    table.weights[i] = (weight < 1e-30) ? 0.0f : static_cast<float>(weight);
+  }
+}
+
+/** Scalar row kernel, one pixel per iteration */
+template <typename T>
+static void FilterRowScalar(const T* src, ptrdiff_t stride, int cols,
+                            int radius, const float* closeness,
+                            const float* table, int table_last, float scale,
+                            float* dst) {
+  const int width = 2 * radius + 1;
+
+  for (int col = 0; col < cols; col++) {
+    const float center = src[col];
+    float value = 0.0f;
+    float weight = 0.0f;
+
+    for (int dy = -radius; dy <= radius; dy++) {
+      const T* row = src + dy * stride + col;
+      const float* kernel_row = closeness + (dy + radius) * width + radius;
+      for (int dx = -radius; dx <= radius; dx++) {
+        const float neighbour = row[dx];
+        const int idx = std::min(
+            static_cast<int>(std::fabs(neighbour - center) * scale + 0.5f),
+            table_last);
+        const float w = kernel_row[dx] * table[idx];
+        value += w * neighbour;
+        weight += w;
+      }
+    }
+
+    dst[col] = value / weight;
+  }
+}
+
+/** Scalar accumulation kernel, one pixel per iteration */
+static void AccumulateRowScalar(const float* src, ptrdiff_t stride,
+                                const float* center, int cols, int radius,
+                                const float* closeness, const float* table,
+                                int table_last, float scale, float* value,
+                                float* weight) {
+  const int width = 2 * radius + 1;
+
+  for (int col = 0; col < cols; col++) {
+    float col_value = 0.0f;
+    float col_weight = 0.0f;
+
+    for (int dy = -radius; dy <= radius; dy++) {
+      const float* row = src + dy * stride + col;
+      const float* kernel_row = closeness + (dy + radius) * width + radius;
+      for (int dx = -radius; dx <= radius; dx++) {
+        const float neighbour = row[dx];
+        const int idx = std::min(
+            static_cast<int>(std::fabs(neighbour - center[col]) * scale +
+                             0.5f),
+            table_last);
+        const float w = kernel_row[dx] * table[idx];
+        col_value += w * neighbour;
+        col_weight += w;
+      }
+    }
+
+    value[col] += col_value;
+    weight[col] += col_weight;
+  }
+}
+
+#if IPCV_BILATERAL_X86
+// Load eight samples widened to float
+__attribute__((target("avx2,fma"))) static inline __m256 Load8(
+    const float* p) {
+  return _mm256_loadu_ps(p);
+}
+__attribute__((target("avx2,fma"))) static inline __m256 Load8(
+    const unsigned char* p) {
+  return _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(
+      _mm_loadl_epi64(reinterpret_cast<const __m128i*>(p))));
+}
+__attribute__((target("avx2,fma"))) static inline __m256 Load8(
+    const unsigned short* p) {
+  return _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(p))));
+}
+
+// Load sixteen samples widened to float
+__attribute__((target("avx512f"))) static inline __m512 Load16(
+    const float* p) {
+  return _mm512_loadu_ps(p);
+}
+__attribute__((target("avx512f"))) static inline __m512 Load16(
+    const unsigned char* p) {
+  return _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(p))));
+}
+__attribute__((target("avx512f"))) static inline __m512 Load16(
+    const unsigned short* p) {
+  return _mm512_cvtepi32_ps(_mm512_cvtepu16_epi32(
+      _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p))));
+}
+
+/** AVX2 row kernel, eight adjacent pixels per iteration */
+template <typename T>
+__attribute__((target("avx2,fma"))) static void FilterRowAvx2(
+    const T* src, ptrdiff_t stride, int cols, int radius,
+    const float* closeness, const float* table, int table_last, float scale,
+    float* dst) {
+  const int width = 2 * radius + 1;
+  const __m256 scale_v = _mm256_set1_ps(scale);
+  const __m256 half_v = _mm256_set1_ps(0.5f);
+  const __m256 abs_mask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff));
+  const __m256i last_v = _mm256_set1_epi32(table_last);
+
+  int col = 0;
+  for (; col + 8 <= cols; col += 8) {
+    const __m256 center = Load8(src + col);
+    __m256 value = _mm256_setzero_ps();
+    __m256 weight = _mm256_setzero_ps();
+
+    for (int dy = -radius; dy <= radius; dy++) {
+      const T* row = src + dy * stride + col;
+      const float* kernel_row = closeness + (dy + radius) * width + radius;
+      for (int dx = -radius; dx <= radius; dx++) {
+        const __m256 neighbour = Load8(row + dx);
+        const __m256 difference =
+            _mm256_and_ps(_mm256_sub_ps(neighbour, center), abs_mask);
+        const __m256i idx = _mm256_min_epi32(
+            _mm256_cvttps_epi32(_mm256_fmadd_ps(difference, scale_v, half_v)),
+            last_v);
+        const __m256 w = _mm256_mul_ps(_mm256_set1_ps(kernel_row[dx]),
+                                       _mm256_i32gather_ps(table, idx, 4));
+        value = _mm256_fmadd_ps(w, neighbour, value);
+        weight = _mm256_add_ps(weight, w);
+      }
+    }
+
+    _mm256_storeu_ps(dst + col, _mm256_div_ps(value, weight));
+  }
+
+  FilterRowScalar(src + col, stride, cols - col, radius, closeness, table,
+                  table_last, scale, dst + col);
+}
+
+/** AVX-512 row kernel, sixteen adjacent pixels per iteration */
+template <typename T>
+__attribute__((target("avx512f"))) static void FilterRowAvx512(
+    const T* src, ptrdiff_t stride, int cols, int radius,
+    const float* closeness, const float* table, int table_last, float scale,
+    float* dst) {
+  const int width = 2 * radius + 1;
+  const __m512 scale_v = _mm512_set1_ps(scale);
+  const __m512 half_v = _mm512_set1_ps(0.5f);
+  const __m512i last_v = _mm512_set1_epi32(table_last);
+
+  int col = 0;
+  for (; col + 16 <= cols; col += 16) {
+    const __m512 center = Load16(src + col);
+    __m512 value = _mm512_setzero_ps();
+    __m512 weight = _mm512_setzero_ps();
+
+    for (int dy = -radius; dy <= radius; dy++) {
+      const T* row = src + dy * stride + col;
+      const float* kernel_row = closeness + (dy + radius) * width + radius;
+      for (int dx = -radius; dx <= radius; dx++) {
+        const __m512 neighbour = Load16(row + dx);
+        const __m512 difference =
+            _mm512_abs_ps(_mm512_sub_ps(neighbour, center));
+        const __m512i idx = _mm512_min_epi32(
+            _mm512_cvttps_epi32(_mm512_fmadd_ps(difference, scale_v, half_v)),
+            last_v);
+        const __m512 w = _mm512_mul_ps(_mm512_set1_ps(kernel_row[dx]),
+                                       _mm512_i32gather_ps(idx, table, 4));
+        value = _mm512_fmadd_ps(w, neighbour, value);
+        weight = _mm512_add_ps(weight, w);
+      }
+    }
+
+    _mm512_storeu_ps(dst + col, _mm512_div_ps(value, weight));
+  }
+
+  FilterRowAvx2(src + col, stride, cols - col, radius, closeness, table,
+                table_last, scale, dst + col);
+}
+
+/** AVX2 accumulation kernel, eight adjacent pixels per iteration */
+__attribute__((target("avx2,fma"))) static void AccumulateRowAvx2(
+    const float* src, ptrdiff_t stride, const float* center, int cols,
+    int radius, const float* closeness, const float* table, int table_last,
+    float scale, float* value, float* weight) {
+  const int width = 2 * radius + 1;
+  const __m256 scale_v = _mm256_set1_ps(scale);
+  const __m256 half_v = _mm256_set1_ps(0.5f);
+  const __m256 abs_mask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff));
+  const __m256i last_v = _mm256_set1_epi32(table_last);
+
+  int col = 0;
+  for (; col + 8 <= cols; col += 8) {
+    const __m256 center_v = _mm256_loadu_ps(center + col);
+    __m256 value_v = _mm256_loadu_ps(value + col);
+    __m256 weight_v = _mm256_loadu_ps(weight + col);
+
+    for (int dy = -radius; dy <= radius; dy++) {
+      const float* row = src + dy * stride + col;
+      const float* kernel_row = closeness + (dy + radius) * width + radius;
+      for (int dx = -radius; dx <= radius; dx++) {
+        const __m256 neighbour = _mm256_loadu_ps(row + dx);
+        const __m256 difference =
+            _mm256_and_ps(_mm256_sub_ps(neighbour, center_v), abs_mask);
+        const __m256i idx = _mm256_min_epi32(
+            _mm256_cvttps_epi32(_mm256_fmadd_ps(difference, scale_v, half_v)),
+            last_v);
+        const __m256 w = _mm256_mul_ps(_mm256_set1_ps(kernel_row[dx]),
+                                       _mm256_i32gather_ps(table, idx, 4));
+        value_v = _mm256_fmadd_ps(w, neighbour, value_v);
+        weight_v = _mm256_add_ps(weight_v, w);
+      }
+    }
+
+    _mm256_storeu_ps(value + col, value_v);
+    _mm256_storeu_ps(weight + col, weight_v);
+  }
+
+  AccumulateRowScalar(src + col, stride, center + col, cols - col, radius,
+                      closeness, table, table_last, scale, value + col,
+                      weight + col);
+}
+
+/** AVX-512 accumulation kernel, sixteen adjacent pixels per iteration */
+__attribute__((target("avx512f"))) static void AccumulateRowAvx512(
+    const float* src, ptrdiff_t stride, const float* center, int cols,
+    int radius, const float* closeness, const float* table, int table_last,
+    float scale, float* value, float* weight) {
+  const int width = 2 * radius + 1;
+  const __m512 scale_v = _mm512_set1_ps(scale);
+  const __m512 half_v = _mm512_set1_ps(0.5f);
+  const __m512i last_v = _mm512_set1_epi32(table_last);
+
+  int col = 0;
+  for (; col + 16 <= cols; col += 16) {
+    const __m512 center_v = _mm512_loadu_ps(center + col);
+    __m512 value_v = _mm512_loadu_ps(value + col);
+    __m512 weight_v = _mm512_loadu_ps(weight + col);
+
+    for (int dy = -radius; dy <= radius; dy++) {
+      const float* row = src + dy * stride + col;
+      const float* kernel_row = closeness + (dy + radius) * width + radius;
+      for (int dx = -radius; dx <= radius; dx++) {
+        const __m512 neighbour = _mm512_loadu_ps(row + dx);
+        const __m512 difference =
+            _mm512_abs_ps(_mm512_sub_ps(neighbour, center_v));
+        const __m512i idx = _mm512_min_epi32(
+            _mm512_cvttps_epi32(_mm512_fmadd_ps(difference, scale_v, half_v)),
+            last_v);
+        const __m512 w = _mm512_mul_ps(_mm512_set1_ps(kernel_row[dx]),
+                                       _mm512_i32gather_ps(idx, table, 4));
+        value_v = _mm512_fmadd_ps(w, neighbour, value_v);
+        weight_v = _mm512_add_ps(weight_v, w);
+      }
+    }
+
+    _mm512_storeu_ps(value + col, value_v);
+    _mm512_storeu_ps(weight + col, weight_v);
+  }
+
+  AccumulateRowAvx2(src + col, stride, center + col, cols - col, radius,
+                    closeness, table, table_last, scale, value + col,
+                    weight + col);
+}
+#endif
+
+/** Pick the widest row kernel supported by the running CPU */
+template <typename T>
+static RowKernel<T> SelectRowKernel() {
+#if IPCV_BILATERAL_X86
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f")) {
+    return FilterRowAvx512<T>;
+  }
+  if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+    return FilterRowAvx2<T>;
+  }
+#endif
+  return FilterRowScalar<T>;
+}
+
+/** Pick the widest accumulation kernel supported by the running CPU */
+static AccumulateKernel SelectAccumulateKernel() {
+#if IPCV_BILATERAL_X86
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f")) {
+    return AccumulateRowAvx512;
+  }
+  if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+    return AccumulateRowAvx2;
+  }
+#endif
+  return AccumulateRowScalar;
+}
+
+/** Run the selected row kernel for the sample type T */
+template <typename T>
+static void FilterRow(const T* src, const ptrdiff_t stride, const int cols,
+                      const int radius, const float* closeness,
+                      const RangeKernelTable& table, float* dst) {
+  static const RowKernel<T> kernel = SelectRowKernel<T>();
+
+  kernel(src, stride, cols, radius, closeness, table.weights.data(),
+         static_cast<int>(table.weights.size()) - 1, table.scale, dst);
+}
+
+/** Bilateral filter one row of a single-channel plane
+ *
+ *  \param[in] src        pointer to the first pixel of the row to filter
+ *  \param[in] stride     distance (in samples) between consecutive rows
+ *  \param[in] cols       number of pixels in the row
+ *  \param[in] radius     radius of the bilateral filter
+ *  \param[in] closeness  (2 * radius + 1)^2 closeness (spatial) weights in
+ *                        row-major order
+ *  \param[in] table      tabulated range kernel
+ *  \param[out] dst       filtered row of cols pixels
+ */
+void BilateralFilterRow(const float* src, const ptrdiff_t stride,
+                        const int cols, const int radius,
+                        const float* closeness, const RangeKernelTable& table,
+                        float* dst) {
+  FilterRow(src, stride, cols, radius, closeness, table, dst);
+}
+
+void BilateralFilterRow(const unsigned char* src, const ptrdiff_t stride,
+                        const int cols, const int radius,
+                        const float* closeness, const RangeKernelTable& table,
+                        float* dst) {
+  FilterRow(src, stride, cols, radius, closeness, table, dst);
+}
+
+void BilateralFilterRow(const unsigned short* src, const ptrdiff_t stride,
+                        const int cols, const int radius,
+                        const float* closeness, const RangeKernelTable& table,
+                        float* dst) {
+  FilterRow(src, stride, cols, radius, closeness, table, dst);
+}
+
+/** Accumulate the bilateral weights of one row of a neighbour plane
+ *  against a row of center values
+ *
+ *  \param[in] src        pointer to the first neighbour-plane pixel of the
+ *                        row
+ *  \param[in] stride     distance (in samples) between consecutive rows of
+ *                        the neighbour plane
+ *  \param[in] center     cols center values
+ *  \param[in] cols       number of pixels in the row
+ *  \param[in] radius     radius of the bilateral filter
+ *  \param[in] closeness  (2 * radius + 1)^2 closeness weights in row-major
+ *                        order
+ *  \param[in] table      tabulated range kernel
+ *  \param[in,out] value  cols running weighted sums
+ *  \param[in,out] weight cols running sums of weights
+ */
+void BilateralAccumulateRow(const float* src, const ptrdiff_t stride,
+                            const float* center, const int cols,
+                            const int radius, const float* closeness,
+                            const RangeKernelTable& table, float* value,
+                            float* weight) {
+  static const AccumulateKernel kernel = SelectAccumulateKernel();
+
+  kernel(src, stride, center, cols, radius, closeness, table.weights.data(),
+         static_cast<int>(table.weights.size()) - 1, table.scale, value,
+         weight);
+}
+}
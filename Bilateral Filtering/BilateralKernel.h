@@ -0,0 +1,97 @@
+/** Interface file for the vectorized bilateral filter row kernel
+ *
+ *  \file ipcv/bilateral_filtering/BilateralKernel.h
+ *  \author Anthony Guarino (ag4933@rit.edu)
+ *  \date 16 Oct 2026
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace ipcv {
+
+/** Range (similarity) kernel tabulated on quantized absolute differences
+ *
+ *  \var weights  exp(-0.5 * d^2 / sigma_range^2) sampled at d = i / scale
+ *  \var scale    number of table entries per unit of difference
+ */
+struct RangeKernelTable {
+  std::vector<float> weights;
+  float scale;
+};
+
+/** Tabulate the range kernel
+ *
+ *  Differences are quantized to 1/256 of the range standard deviation, so
+ *  the tabulated weight differs from the analytic weight by less than
+ *  0.0012 (the maximum slope of the Gaussian, 0.607 / sigma_range, times
+ *  half a quantization step).  The table stops at twelve standard
+ *  deviations, beyond which every weight is zero in single precision.
+ *
+ *  \param[in] sigma_range      standard deviation of range/similarity filter
+ *  \param[in] max_difference   largest absolute difference to be looked up
+ *  \param[out] table           tabulated range kernel
+ */
+void MakeRangeKernelTable(const double sigma_range, const double max_difference,
+                          RangeKernelTable& table);
+
+/** Bilateral filter one row of a single-channel plane
+ *
+ *  Neighbours are read through row pointers, so the plane must provide
+ *  radius valid samples on every side of the row being filtered.  Samples
+ *  are widened to float on load.  The kernel is selected once at run time:
+ *  AVX-512 (16 pixels per iteration), AVX2 (8 pixels per iteration) or a
+ *  scalar fallback.
+ *
+ *  \param[in] src        pointer to the first pixel of the row to filter
+ *                        (uchar, ushort or float samples)
+ *  \param[in] stride     distance (in samples) between consecutive rows
+ *  \param[in] cols       number of pixels in the row
+ *  \param[in] radius     radius of the bilateral filter
+ *  \param[in] closeness  (2 * radius + 1)^2 closeness (spatial) weights in
+ *                        row-major order
+ *  \param[in] table      tabulated range kernel
+ *  \param[out] dst       filtered row of cols pixels
+ */
+void BilateralFilterRow(const float* src, const std::ptrdiff_t stride,
+                        const int cols, const int radius,
+                        const float* closeness, const RangeKernelTable& table,
+                        float* dst);
+void BilateralFilterRow(const unsigned char* src, const std::ptrdiff_t stride,
+                        const int cols, const int radius,
+                        const float* closeness, const RangeKernelTable& table,
+                        float* dst);
+void BilateralFilterRow(const unsigned short* src, const std::ptrdiff_t stride,
+                        const int cols, const int radius,
+                        const float* closeness, const RangeKernelTable& table,
+                        float* dst);
+
+/** Accumulate the bilateral weights of one row of a (possibly different)
+ *  neighbour plane against a row of center values
+ *
+ *  Used for spatio-temporal filtering, where the neighbours of a pixel come
+ *  from several frames: value += sum(w * neighbour), weight += sum(w) with
+ *  w = closeness * range(|neighbour - center|).  The neighbour plane must
+ *  provide radius valid samples on every side of the row.
+ *
+ *  \param[in] src        pointer to the first neighbour-plane pixel of the
+ *                        row
+ *  \param[in] stride     distance (in samples) between consecutive rows of
+ *                        the neighbour plane
+ *  \param[in] center     cols center values
+ *  \param[in] cols       number of pixels in the row
+ *  \param[in] radius     radius of the bilateral filter
+ *  \param[in] closeness  (2 * radius + 1)^2 closeness weights in row-major
+ *                        order (may include a temporal weight)
+ *  \param[in] table      tabulated range kernel
+ *  \param[in,out] value  cols running weighted sums
+ *  \param[in,out] weight cols running sums of weights
+ */
+void BilateralAccumulateRow(const float* src, const std::ptrdiff_t stride,
+                            const float* center, const int cols,
+                            const int radius, const float* closeness,
+                            const RangeKernelTable& table, float* value,
+                            float* weight);
+}
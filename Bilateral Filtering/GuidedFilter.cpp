@@ -0,0 +1,168 @@
+/** Implementation file for guided filtering
+ *
+ *  \file ipcv/bilateral_filtering/GuidedFilter.cpp
+ *  \author Anthony Guarino (ag4933@rit.edu)
+ *  \date 16 Oct 2026
+ */
+
+#include "GuidedFilter.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include <opencv2/imgproc.hpp>
+
+using namespace std;
+
+namespace ipcv {
+
+/** Mean over the (2 radius + 1) square window (inputs are padded, so the
+ *  border handling of cv::boxFilter only touches discarded samples)
+ *
+ *  \param[in] src     source cv::Mat of CV_32FC1
+ *  \param[out] dst    destination cv::Mat of CV_32FC1
+ *  \param[in] radius  window radius
+ */
+static void BoxMean(const cv::Mat& src, cv::Mat& dst, const int radius) {
+  cv::boxFilter(src, dst, CV_32F, cv::Size(2 * radius + 1, 2 * radius + 1),
+                cv::Point(-1, -1), true, cv::BORDER_REPLICATE);
+}
+
+/** Fit the averaged linear coefficients of one plane to its guide
+ *
+ *  \param[in] guide    guide plane, cv::Mat of CV_32FC1
+ *  \param[in] plane    source plane, cv::Mat of CV_32FC1
+ *  \param[in] radius   window radius
+ *  \param[in] epsilon  regularization of the slope
+ *  \param[out] mean_a  window mean of the slope
+ *  \param[out] mean_b  window mean of the offset
+ */
+static void FitCoefficients(const cv::Mat& guide, const cv::Mat& plane,
+                            const int radius, const double epsilon,
+                            cv::Mat& mean_a, cv::Mat& mean_b) {
+  cv::Mat mean_i, mean_p, mean_ii, mean_ip;
+  BoxMean(guide, mean_i, radius);
+  BoxMean(plane, mean_p, radius);
+  BoxMean(guide.mul(guide), mean_ii, radius);
+  BoxMean(guide.mul(plane), mean_ip, radius);
+
+  const cv::Mat variance = mean_ii - mean_i.mul(mean_i);
+  const cv::Mat covariance = mean_ip - mean_i.mul(mean_p);
+  const cv::Mat regularized = variance + epsilon;
+
+  cv::Mat a, b;
+  cv::divide(covariance, regularized, a);
+  b = mean_p - a.mul(mean_i);
+
+  BoxMean(a, mean_a, radius);
+  BoxMean(b, mean_b, radius);
+}
+
+/** Edge-preserving smoothing with the guided filter
+ *
+ *  \param[in] src             source cv::Mat
+ *  \param[in] guide           guide cv::Mat (or empty for self guidance)
+ *  \param[out] dst            destination cv::Mat of the same type as src
+ *  \param[in] sigma_distance  standard deviation of distance/closeness
+ *  \param[in] sigma_range     range standard deviation, in source units
+ *  \param[in] radius          radius of the window
+ *  \param[in] subsample       subsampling factor of the fast guided filter
+ *  \param[in] border_mode     pixel extrapolation method
+ *  \param[in] border_value    value to use for constant border mode
+ */
+bool GuidedFilter(const cv::Mat& src, const cv::Mat& guide, cv::Mat& dst,
+                  const double sigma_distance, const double sigma_range,
+                  const int radius, const int subsample,
+                  const BorderMode border_mode, uint8_t border_value) {
+  if (src.empty() || subsample < 1 ||
+      (src.channels() != 1 && src.channels() != 3)) {
+    return false;
+  }
+  if (src.depth() != CV_8U && src.depth() != CV_16U &&
+      src.depth() != CV_32F) {
+    return false;
+  }
+  if (!guide.empty() &&
+      (guide.size() != src.size() ||
+       (guide.channels() != 1 && guide.channels() != 3))) {
+    return false;
+  }
+
+  const int r = (radius <= 0) ? static_cast<int>(2 * sigma_distance) : radius;
+  if (r < 1) {
+    return false;
+  }
+  const double epsilon = sigma_range * sigma_range;
+
+  // Pad by twice the radius, so that every coefficient averaged into an
+  // output pixel comes from a window lying entirely in the padded images
+  const int pad = 2 * r;
+  auto pad_plane = [&](const cv::Mat& plane, cv::Mat& padded) {
+    if (border_mode == BorderMode::CONSTANT) {
+      cv::copyMakeBorder(plane, padded, pad, pad, pad, pad,
+                         cv::BORDER_CONSTANT, cv::Scalar::all(border_value));
+    } else {
+      cv::copyMakeBorder(plane, padded, pad, pad, pad, pad,
+                         cv::BORDER_REPLICATE);
+    }
+  };
+
+  vector<cv::Mat> planes;
+  cv::Mat src_float;
+  src.convertTo(src_float, CV_32F);
+  cv::split(src_float, planes);
+  for (auto& plane : planes) {
+    cv::Mat padded;
+    pad_plane(plane, padded);
+    plane = padded;
+  }
+
+  cv::Mat guide_plane;
+  if (!guide.empty()) {
+    cv::Mat guide_gray;
+    if (guide.channels() == 3) {
+      cv::cvtColor(guide, guide_gray, cv::COLOR_BGR2GRAY);
+    } else {
+      guide_gray = guide;
+    }
+    cv::Mat guide_float;
+    guide_gray.convertTo(guide_float, CV_32F);
+    pad_plane(guide_float, guide_plane);
+  }
+
+  const cv::Size padded_size = planes[0].size();
+  const cv::Size low_size((padded_size.width + subsample - 1) / subsample,
+                          (padded_size.height + subsample - 1) / subsample);
+  const int low_radius = std::max(
+      1, static_cast<int>(std::lround(r / static_cast<double>(subsample))));
+
+  vector<cv::Mat> filtered;
+  for (const auto& plane : planes) {
+    const cv::Mat& guide_full = guide_plane.empty() ? plane : guide_plane;
+
+    cv::Mat mean_a, mean_b;
+    if (subsample == 1) {
+      FitCoefficients(guide_full, plane, r, epsilon, mean_a, mean_b);
+    } else {
+      cv::Mat guide_low, plane_low, mean_a_low, mean_b_low;
+      cv::resize(guide_full, guide_low, low_size, 0, 0, cv::INTER_AREA);
+      cv::resize(plane, plane_low, low_size, 0, 0, cv::INTER_AREA);
+      FitCoefficients(guide_low, plane_low, low_radius, epsilon, mean_a_low,
+                      mean_b_low);
+      cv::resize(mean_a_low, mean_a, padded_size, 0, 0, cv::INTER_LINEAR);
+      cv::resize(mean_b_low, mean_b, padded_size, 0, 0, cv::INTER_LINEAR);
+    }
+
+    const cv::Rect interior(pad, pad, src.cols, src.rows);
+    filtered.push_back(mean_a(interior).mul(guide_full(interior)) +
+                       mean_b(interior));
+  }
+
+  cv::Mat dst_float;
+  cv::merge(filtered, dst_float);
+  dst_float.convertTo(dst, src.depth());
+
+  return true;
+}
+}
@@ -0,0 +1,53 @@
+/** Interface file for guided filtering
+ *
+ *  \file ipcv/bilateral_filtering/GuidedFilter.h
+ *  \author Anthony Guarino (ag4933@rit.edu)
+ *  \date 16 Oct 2026
+ */
+
+#pragma once
+
+#include <opencv2/core.hpp>
+
+#include "BilateralFilter.h"
+
+namespace ipcv {
+
+/** Edge-preserving smoothing with the guided filter (He, Sun and Tang)
+ *
+ *  Every output pixel is a local linear function a * I + b of the guide I,
+ *  with a and b fitted by least squares to the source over the
+ *  (2r+1)x(2r+1) window and then averaged over every window covering the
+ *  pixel.  All window statistics (means, variance and covariance) are box
+ *  filtered, so the cost is linear in the number of pixels and does not
+ *  depend on the radius.  With a subsampling factor s > 1 (the fast guided
+ *  filter) the coefficients are fitted on the source and guide reduced by
+ *  s with the radius reduced accordingly and bilinearly enlarged before
+ *  being applied to the full resolution guide, dividing the cost by about
+ *  s^2.
+ *
+ *  \param[in] src             source cv::Mat (CV_8U, CV_16U or CV_32F
+ *                             samples with one or three channels)
+ *  \param[in] guide           guide cv::Mat of the size of src (one channel,
+ *                             or three channel BGR used as its gray level),
+ *                             if empty every channel of src guides itself
+ *  \param[out] dst            destination cv::Mat of the same type as src
+ *  \param[in] sigma_distance  standard deviation of distance/closeness,
+ *                             only used to choose the radius
+ *  \param[in] sigma_range     range standard deviation, in source units; the
+ *                             regularization is sigma_range^2, so edges with
+ *                             a contrast well above sigma_range are kept
+ *  \param[in] radius          radius of the window (if negative, use twice
+ *                             the standard deviation of the distance/
+ *                             closeness filter)
+ *  \param[in] subsample       subsampling factor of the fast guided filter
+ *                             [1 is the exact filter]
+ *  \param[in] border_mode     pixel extrapolation method
+ *  \param[in] border_value    value to use for constant border mode
+ */
+bool GuidedFilter(const cv::Mat& src, const cv::Mat& guide, cv::Mat& dst,
+                  const double sigma_distance, const double sigma_range,
+                  const int radius, const int subsample = 1,
+                  const BorderMode border_mode = BorderMode::REPLICATE,
+                  uint8_t border_value = 0);
+}
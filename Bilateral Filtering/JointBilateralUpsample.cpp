@@ -0,0 +1,286 @@
+/** Implementation file for joint bilateral upsampling of a low resolution
+ *  bilateral filter
+ *
+ *  \file ipcv/bilateral_filtering/JointBilateralUpsample.cpp
+ *  \author Anthony Guarino (ag4933@rit.edu)
+ *  \date 16 Oct 2026
+ */
+
+#include "JointBilateralUpsample.h"
+#include "BilateralKernel.h"
+#include "Lightness.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+
+#include <opencv2/imgproc.hpp>
+
+using namespace std;
+
+namespace ipcv {
+
+// Radius and distance standard deviation (in low resolution pixels) of the
+// upsampling kernel
+static const int kUpsampleRadius = 2;
+static const double kUpsampleSigma = 1.0;
+
+// Number of rows converted back to BGR at a time
+static const int kStripRows = 64;
+
+/** Low resolution neighbours of every full resolution row (or column)
+ *
+ *  \var low     index of the low resolution sample
+ *  \var guide   index of the full resolution guide sample at its center
+ *  \var weight  distance weight (zero for neighbours outside the image)
+ */
+struct UpsampleTaps {
+  vector<int> low;
+  vector<int> guide;
+  vector<float> weight;
+};
+
+/** Tabulate the upsampling taps along one dimension
+ *
+ *  \param[in] full_size  number of full resolution samples
+ *  \param[in] low_size   number of low resolution samples
+ *  \param[out] taps      2 * kUpsampleRadius + 1 taps per full resolution
+ *                        sample
+ */
+static void MakeUpsampleTaps(const int full_size, const int low_size,
+                             UpsampleTaps& taps) {
+  const int width = 2 * kUpsampleRadius + 1;
+  const double scale = full_size / static_cast<double>(low_size);
+
+  taps.low.assign(full_size * width, 0);
+  taps.guide.assign(full_size * width, 0);
+  taps.weight.assign(full_size * width, 0.0f);
+
+  for (int idx = 0; idx < full_size; idx++) {
+    // Position of the full resolution sample on the low resolution grid
+    const double position = (idx + 0.5) / scale - 0.5;
+    const int nearest = static_cast<int>(std::floor(position + 0.5));
+
+    for (int k = -kUpsampleRadius; k <= kUpsampleRadius; k++) {
+      const int low_idx = nearest + k;
+      if (low_idx < 0 || low_idx >= low_size) {
+        continue;
+      }
+      const double distance = position - low_idx;
+      const int tap = idx * width + k + kUpsampleRadius;
+      taps.low[tap] = low_idx;
+      taps.guide[tap] = std::min(static_cast<int>((low_idx + 0.5) * scale),
+                                 full_size - 1);
+      taps.weight[tap] = static_cast<float>(std::exp(
+          -0.5 * (distance * distance) / (kUpsampleSigma * kUpsampleSigma)));
+    }
+  }
+}
+
+/** Joint bilateral upsampling of a single-channel plane
+ *
+ *  \param[in] low          low resolution (filtered) cv::Mat of CV_32FC1
+ *  \param[in] guide        full resolution guide cv::Mat of CV_32FC1
+ *  \param[in] sigma_range  standard deviation of range/similarity filter
+ *  \param[out] dst         full resolution cv::Mat of CV_32FC1
+ */
+static void UpsamplePlane(const cv::Mat& low, const cv::Mat& guide,
+                          const double sigma_range, cv::Mat& dst) {
+  dst.create(guide.size(), CV_32FC1);
+
+  const int width = 2 * kUpsampleRadius + 1;
+  UpsampleTaps row_taps, col_taps;
+  MakeUpsampleTaps(guide.rows, low.rows, row_taps);
+  MakeUpsampleTaps(guide.cols, low.cols, col_taps);
+
+  double min_guide, max_guide;
+  cv::minMaxLoc(guide, &min_guide, &max_guide);
+  RangeKernelTable range_table;
+  MakeRangeKernelTable(sigma_range, max_guide - min_guide, range_table);
+  const int table_last = static_cast<int>(range_table.weights.size()) - 1;
+
+  for (int row_idx = 0; row_idx < guide.rows; row_idx++) {
+    const float* guide_row = guide.ptr<float>(row_idx);
+    float* dst_row = dst.ptr<float>(row_idx);
+
+    for (int col_idx = 0; col_idx < guide.cols; col_idx++) {
+      const float center = guide_row[col_idx];
+      float value = 0.0f;
+      float weight = 0.0f;
+
+      for (int ky = 0; ky < width; ky++) {
+        const float wy = row_taps.weight[row_idx * width + ky];
+        if (wy == 0.0f) {
+          continue;
+        }
+        const float* low_row = low.ptr<float>(row_taps.low[row_idx * width + ky]);
+        const float* guide_tap_row =
+            guide.ptr<float>(row_taps.guide[row_idx * width + ky]);
+
+        for (int kx = 0; kx < width; kx++) {
+          const int tap = col_idx * width + kx;
+          const float wx = col_taps.weight[tap];
+          if (wx == 0.0f) {
+            continue;
+          }
+          const int idx = std::min(
+              static_cast<int>(std::fabs(guide_tap_row[col_taps.guide[tap]] -
+                                         center) *
+                                   range_table.scale +
+                               0.5f),
+              table_last);
+          const float w = wy * wx * range_table.weights[idx];
+          value += w * low_row[col_taps.low[tap]];
+          weight += w;
+        }
+      }
+
+      // Fall back to the nearest low resolution value if every neighbour
+      // is too dissimilar to contribute
+      dst_row[col_idx] =
+          (weight > 0.0f)
+              ? value / weight
+              : low.at<float>(row_taps.low[row_idx * width + kUpsampleRadius],
+                              col_taps.low[col_idx * width + kUpsampleRadius]);
+    }
+  }
+}
+
+/** Bilateral filter an image at reduced resolution and bring the result
+ *  back to full resolution with joint bilateral upsampling
+ *
+ *  \param[in] src             source cv::Mat of CV_8UC3 (or CV_8UC1,
+ *                             CV_16UC1, CV_32FC1)
+ *  \param[out] dst            destination cv::Mat of the same type as src
+ *  \param[in] sigma_distance  standard deviation of distance/closeness filter
+ *                             at full resolution
+ *  \param[in] sigma_range     standard deviation of range/similarity filter,
+ *                             also used for the upsampling range kernel
+ *  \param[in] radius          full resolution radius of the bilateral filter
+ *                             (if negative, use twice the standard deviation
+ *                             of the distance/closeness filter)
+ *  \param[in] factor          resolution reduction factor (e.g. 4 or 8)
+ *  \param[in] border_mode     pixel extrapolation method
+ *  \param[in] border_value    value to use for constant border mode
+ */
+bool JointBilateralUpsample(const cv::Mat& src, cv::Mat& dst,
+                            const double sigma_distance,
+                            const double sigma_range, const int radius,
+                            const int factor, const BorderMode border_mode,
+                            uint8_t border_value) {
+  if (factor <= 1) {
+    return BilateralFilter(src, dst, sigma_distance, sigma_range, radius,
+                           border_mode, border_value);
+  }
+
+  const bool color = (src.type() == CV_8UC3);
+  if (!color && src.type() != CV_8UC1 && src.type() != CV_16UC1 &&
+      src.type() != CV_32FC1) {
+    return false;
+  }
+
+  // Filter a reduced copy of the source
+  cv::Mat low, low_filtered;
+  cv::resize(src, low,
+             cv::Size((src.cols + factor - 1) / factor,
+                      (src.rows + factor - 1) / factor),
+             0, 0, cv::INTER_AREA);
+  const int low_radius = (radius <= 0) ? -1 : std::max(1, radius / factor);
+  if (!BilateralFilter(low, low_filtered, sigma_distance / factor,
+                       sigma_range, low_radius, border_mode, border_value)) {
+    return false;
+  }
+  low.release();
+
+  // Upsample the filtered lightness (or intensity) guided by the source
+  cv::Mat guide, low_plane, dst_plane;
+  if (color) {
+    LightnessPlane(src, guide);
+    LightnessPlane(low_filtered, low_plane);
+  } else {
+    src.convertTo(guide, CV_32F);
+    low_filtered.convertTo(low_plane, CV_32F);
+  }
+  low_filtered.release();
+
+  UpsamplePlane(low_plane, guide, sigma_range, dst_plane);
+  guide.release();
+
+  if (!color) {
+    dst_plane.convertTo(dst, src.type());
+    return true;
+  }
+
+  // Convert back to BGR color space and set the output
+  dst.create(src.size(), src.type());
+  for (int first_row = 0; first_row < src.rows; first_row += kStripRows) {
+    const int strip_rows = std::min(kStripRows, src.rows - first_row);
+    ReplaceLightness(src, dst_plane.rowRange(first_row, first_row + strip_rows),
+                     first_row, dst);
+  }
+
+  return true;
+}
+
+/** Measure the quality-vs-speed trade-off of joint bilateral upsampling
+ *  against the exact bilateral filter for a list of reduction factors
+ *
+ *  \param[in] src             source cv::Mat (see JointBilateralUpsample)
+ *  \param[in] sigma_distance  standard deviation of distance/closeness filter
+ *  \param[in] sigma_range     standard deviation of range/similarity filter
+ *  \param[in] radius          radius of the bilateral filter
+ *  \param[in] factors         reduction factors to evaluate
+ *  \param[out] report         one entry per reduction factor
+ */
+bool JointBilateralUpsampleQuality(const cv::Mat& src,
+                                   const double sigma_distance,
+                                   const double sigma_range, const int radius,
+                                   const vector<int>& factors,
+                                   vector<UpsampleQuality>& report) {
+  report.clear();
+
+  cv::Mat exact;
+  auto start_time = chrono::steady_clock::now();
+  if (!BilateralFilter(src, exact, sigma_distance, sigma_range, radius)) {
+    return false;
+  }
+  const double exact_seconds =
+      chrono::duration<double>(chrono::steady_clock::now() - start_time)
+          .count();
+
+  // Peak value used for the signal-to-noise ratio
+  double peak = 255;
+  if (src.depth() == CV_16U) {
+    peak = 65535;
+  } else if (src.depth() == CV_32F) {
+    cv::minMaxLoc(exact.reshape(1), nullptr, &peak);
+  }
+
+  for (const int factor : factors) {
+    cv::Mat approximate;
+    start_time = chrono::steady_clock::now();
+    if (!JointBilateralUpsample(src, approximate, sigma_distance, sigma_range,
+                                radius, factor)) {
+      return false;
+    }
+
+    UpsampleQuality quality;
+    quality.factor = factor;
+    quality.exact_seconds = exact_seconds;
+    quality.upsample_seconds =
+        chrono::duration<double>(chrono::steady_clock::now() - start_time)
+            .count();
+    quality.max_error = cv::norm(exact, approximate, cv::NORM_INF);
+
+    const double l2 = cv::norm(exact, approximate, cv::NORM_L2);
+    const double mse = l2 * l2 / (exact.total() * exact.channels());
+    quality.psnr = (mse > 0) ? 10 * std::log10(peak * peak / mse)
+                             : std::numeric_limits<double>::infinity();
+
+    report.push_back(quality);
+  }
+
+  return true;
+}
+}
@@ -0,0 +1,84 @@
+/** Interface file for joint bilateral upsampling of a low resolution
+ *  bilateral filter
+ *
+ *  \file ipcv/bilateral_filtering/JointBilateralUpsample.h
+ *  \author Anthony Guarino (ag4933@rit.edu)
+ *  \date 16 Oct 2026
+ */
+
+#pragma once
+
+#include <vector>
+
+#include <opencv2/core.hpp>
+
+#include "BilateralFilter.h"
+
+namespace ipcv {
+
+/** Bilateral filter an image at reduced resolution and bring the result
+ *  back to full resolution with joint bilateral upsampling, using the full
+ *  resolution image as the edge-aware guide
+ *
+ *  The source is reduced by factor in each direction, filtered with the
+ *  distance standard deviation (and radius) scaled down accordingly, and
+ *  every full resolution pixel is then reconstructed from the 5x5 nearest
+ *  low resolution results, weighted by their distance and by how similar
+ *  the guide is at the two locations.  The cost of the exact filter drops
+ *  by roughly factor^2.
+ *
+ *  \param[in] src             source cv::Mat of CV_8UC3 (or CV_8UC1,
+ *                             CV_16UC1, CV_32FC1)
+ *  \param[out] dst            destination cv::Mat of the same type as src
+ *  \param[in] sigma_distance  standard deviation of distance/closeness filter
+ *                             at full resolution
+ *  \param[in] sigma_range     standard deviation of range/similarity filter,
+ *                             also used for the upsampling range kernel
+ *  \param[in] radius          full resolution radius of the bilateral filter
+ *                             (if negative, use twice the standard deviation
+ *                             of the distance/closeness filter)
+ *  \param[in] factor          resolution reduction factor (e.g. 4 or 8)
+ *  \param[in] border_mode     pixel extrapolation method
+ *  \param[in] border_value    value to use for constant border mode
+ */
+bool JointBilateralUpsample(const cv::Mat& src, cv::Mat& dst,
+                            const double sigma_distance,
+                            const double sigma_range, const int radius,
+                            const int factor,
+                            const BorderMode border_mode = BorderMode::REPLICATE,
+                            uint8_t border_value = 0);
+
+/** Quality and speed of joint bilateral upsampling at one reduction factor
+ *  compared to the exact filter
+ *
+ *  \var factor            resolution reduction factor
+ *  \var exact_seconds     wall-clock time of the exact filter [s]
+ *  \var upsample_seconds  wall-clock time of the upsampled filter [s]
+ *  \var psnr              peak signal-to-noise ratio against the exact
+ *                         result [dB]
+ *  \var max_error         largest absolute difference from the exact result
+ */
+struct UpsampleQuality {
+  int factor;
+  double exact_seconds;
+  double upsample_seconds;
+  double psnr;
+  double max_error;
+};
+
+/** Measure the quality-vs-speed trade-off of joint bilateral upsampling
+ *  against the exact bilateral filter for a list of reduction factors
+ *
+ *  \param[in] src             source cv::Mat (see JointBilateralUpsample)
+ *  \param[in] sigma_distance  standard deviation of distance/closeness filter
+ *  \param[in] sigma_range     standard deviation of range/similarity filter
+ *  \param[in] radius          radius of the bilateral filter
+ *  \param[in] factors         reduction factors to evaluate
+ *  \param[out] report         one entry per reduction factor
+ */
+bool JointBilateralUpsampleQuality(const cv::Mat& src,
+                                   const double sigma_distance,
+                                   const double sigma_range, const int radius,
+                                   const std::vector<int>& factors,
+                                   std::vector<UpsampleQuality>& report);
+}
@@ -0,0 +1,58 @@
+/** Implementation file for strip-wise Lab lightness extraction and
+ *  replacement
+ *
+ *  \file ipcv/bilateral_filtering/Lightness.cpp
+ *  \author Anthony Guarino (ag4933@rit.edu)
+ *  \date 16 Oct 2026
+ */
+
+#include "Lightness.h"
+
+#include <algorithm>
+
+#include <opencv2/imgproc.hpp>
+
+namespace ipcv {
+
+// Number of rows converted to Lab at a time
+static const int kStripRows = 64;
+
+/** Compute the Lab lightness plane of a BGR image, one strip at a time
+ *
+ *  \param[in] src   source cv::Mat of CV_8UC3
+ *  \param[out] l    lightness cv::Mat of CV_32FC1
+ */
+void LightnessPlane(const cv::Mat& src, cv::Mat& l) {
+  l.create(src.size(), CV_32FC1);
+
+  cv::Mat strip_float, strip_lab;
+  for (int row = 0; row < src.rows; row += kStripRows) {
+    const cv::Range rows(row, std::min(row + kStripRows, src.rows));
+    src.rowRange(rows.start, rows.end).convertTo(strip_float, CV_32FC3,
+                                                 1 / 255.0);
+    cv::cvtColor(strip_float, strip_lab, cv::COLOR_BGR2Lab);
+    cv::Mat l_strip = l.rowRange(rows.start, rows.end);
+    cv::extractChannel(strip_lab, l_strip, 0);
+  }
+}
+
+/** Replace the lightness of a strip of BGR rows and write the result
+ *
+ *  \param[in] src       source cv::Mat of CV_8UC3
+ *  \param[in] l         new lightness of the strip, cv::Mat of CV_32FC1
+ *  \param[in] first_row first row of the strip in src and dst
+ *  \param[out] dst      destination cv::Mat of CV_8UC3 (already allocated)
+ */
+void ReplaceLightness(const cv::Mat& src, const cv::Mat& l,
+                      const int first_row, cv::Mat& dst) {
+  cv::Mat strip_float, strip_lab, strip_bgr;
+  src.rowRange(first_row, first_row + l.rows)
+      .convertTo(strip_float, CV_32FC3, 1 / 255.0);
+  cv::cvtColor(strip_float, strip_lab, cv::COLOR_BGR2Lab);
+  cv::insertChannel(l, strip_lab, 0);
+  cv::cvtColor(strip_lab, strip_bgr, cv::COLOR_Lab2BGR);
+
+  cv::Mat dst_strip = dst.rowRange(first_row, first_row + l.rows);
+  strip_bgr.convertTo(dst_strip, CV_8UC3, 255);
+}
+}
@@ -0,0 +1,31 @@
+/** Interface file for strip-wise Lab lightness extraction and replacement
+ *
+ *  \file ipcv/bilateral_filtering/Lightness.h
+ *  \author Anthony Guarino (ag4933@rit.edu)
+ *  \date 16 Oct 2026
+ */
+
+#pragma once
+
+#include <opencv2/core.hpp>
+
+namespace ipcv {
+
+/** Compute the Lab lightness plane of a BGR image, one strip at a time, so
+ *  that no full-size float color image is ever allocated
+ *
+ *  \param[in] src   source cv::Mat of CV_8UC3
+ *  \param[out] l    lightness cv::Mat of CV_32FC1
+ */
+void LightnessPlane(const cv::Mat& src, cv::Mat& l);
+
+/** Replace the lightness of a strip of BGR rows and write the result
+ *
+ *  \param[in] src       source cv::Mat of CV_8UC3
+ *  \param[in] l         new lightness of the strip, cv::Mat of CV_32FC1
+ *  \param[in] first_row first row of the strip in src and dst
+ *  \param[out] dst      destination cv::Mat of CV_8UC3 (already allocated)
+ */
+void ReplaceLightness(const cv::Mat& src, const cv::Mat& l,
+                      const int first_row, cv::Mat& dst);
+}
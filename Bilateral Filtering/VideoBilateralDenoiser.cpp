@@ -0,0 +1,173 @@
+/** Implementation file for spatio-temporal (video) bilateral denoising
+ *
+ *  \file ipcv/bilateral_filtering/VideoBilateralDenoiser.cpp
+ *  \author Anthony Guarino (ag4933@rit.edu)
+ *  \date 16 Oct 2026
+ */
+
+#include "VideoBilateralDenoiser.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <opencv2/imgproc.hpp>
+
+using namespace std;
+
+namespace ipcv {
+
+/** Create a denoiser
+ *
+ *  \param[in] sigma_distance  standard deviation of distance/closeness filter
+ *  \param[in] sigma_range     standard deviation of range/similarity filter
+ *  \param[in] radius          radius of the bilateral filter (if negative,
+ *                             use twice the standard deviation of the
+ *                             distance/closeness filter)
+ *  \param[in] frames          number of frames held in the ring buffer
+ *  \param[in] sigma_time      standard deviation of the temporal filter
+ *  \param[in] border_mode     pixel extrapolation method
+ *  \param[in] border_value    value to use for constant border mode
+ */
+VideoBilateralDenoiser::VideoBilateralDenoiser(
+    const double sigma_distance, const double sigma_range, const int radius,
+    const int frames, const double sigma_time, const BorderMode border_mode,
+    uint8_t border_value)
+    : radius_((radius <= 0) ? static_cast<int>(2 * sigma_distance) : radius),
+      frames_(std::max(frames, 1)),
+      border_mode_(border_mode),
+      border_value_(border_value),
+      sigma_range_(sigma_range),
+      border_level_(0.0f),
+      head_(0),
+      count_(0) {
+  // Prepare the closeness kernel (spatial Gaussian) of every frame age,
+  // weighted by the temporal Gaussian
+  const int width = 2 * radius_ + 1;
+  closeness_.resize(frames_);
+  for (int age = 0; age < frames_; age++) {
+    const double temporal =
+        std::exp(-0.5 * (age * age) / (sigma_time * sigma_time));
+    closeness_[age].resize(width * width);
+    for (int row = -radius_; row <= radius_; row++) {
+      for (int col = -radius_; col <= radius_; col++) {
+        closeness_[age][(row + radius_) * width + col + radius_] =
+            temporal * std::exp(-0.5 * ((row * row + col * col) /
+                                        (sigma_distance * sigma_distance)));
+      }
+    }
+  }
+}
+
+/** Forget every buffered frame */
+void VideoBilateralDenoiser::Reset() { count_ = 0; }
+
+/** Allocate the ring buffer and scratch buffers for frames like src
+ *
+ *  \param[in] src  first frame of the stream (CV_8UC3 or CV_8UC1)
+ */
+void VideoBilateralDenoiser::Allocate(const cv::Mat& src) {
+  const bool color = (src.type() == CV_8UC3);
+
+  plane_.create(src.size(), CV_32FC1);
+  if (color) {
+    bgr_float_.create(src.size(), CV_32FC3);
+    lab_.create(src.size(), CV_32FC3);
+  } else {
+    bgr_float_.release();
+    lab_.release();
+  }
+
+  ring_.resize(frames_);
+  for (auto& frame : ring_) {
+    frame.create(src.rows + 2 * radius_, src.cols + 2 * radius_, CV_32FC1);
+  }
+  value_.resize(src.cols);
+  weight_.resize(src.cols);
+
+  // Lightness ranges over [0, 100], intensity over [0, 255]
+  MakeRangeKernelTable(sigma_range_, color ? 100 : 255, range_table_);
+
+  // Plane value of the background color for the constant border mode
+  if (color) {
+    cv::Mat border_bgr(1, 1, CV_32FC3, cv::Scalar::all(border_value_ / 255.0));
+    cv::Mat border_lab;
+    cv::cvtColor(border_bgr, border_lab, cv::COLOR_BGR2Lab);
+    border_level_ = border_lab.at<cv::Vec3f>(0, 0)[0];
+  } else {
+    border_level_ = border_value_;
+  }
+
+  head_ = 0;
+  count_ = 0;
+}
+
+/** Denoise the next frame of the stream
+ *
+ *  \param[in] src   source frame, cv::Mat of CV_8UC3 or CV_8UC1
+ *  \param[out] dst  destination frame of the same size and type as src
+ */
+bool VideoBilateralDenoiser::Denoise(const cv::Mat& src, cv::Mat& dst) {
+  if (src.type() != CV_8UC3 && src.type() != CV_8UC1) {
+    return false;
+  }
+  const bool color = (src.type() == CV_8UC3);
+
+  // (Re)allocate only when the stream geometry changes
+  if (src.size() != plane_.size() || color != !lab_.empty() ||
+      ring_.empty()) {
+    Allocate(src);
+  }
+
+  // Convert the frame and push it into the ring buffer
+  if (color) {
+    src.convertTo(bgr_float_, CV_32FC3, 1 / 255.0);
+    cv::cvtColor(bgr_float_, lab_, cv::COLOR_BGR2Lab);
+    cv::extractChannel(lab_, plane_, 0);
+  } else {
+    src.convertTo(plane_, CV_32F);
+  }
+
+  head_ = (head_ + 1) % frames_;
+  count_ = std::min(count_ + 1, frames_);
+  if (border_mode_ == BorderMode::CONSTANT) {
+    cv::copyMakeBorder(plane_, ring_[head_], radius_, radius_, radius_,
+                       radius_, cv::BORDER_CONSTANT,
+                       cv::Scalar::all(border_level_));
+  } else {
+    cv::copyMakeBorder(plane_, ring_[head_], radius_, radius_, radius_,
+                       radius_, cv::BORDER_REPLICATE);
+  }
+
+  // Apply the spatio-temporal bilateral filter, newest frame first
+  const ptrdiff_t stride = ring_[head_].step / sizeof(float);
+  for (int row_idx = 0; row_idx < src.rows; row_idx++) {
+    const float* center = ring_[head_].ptr<float>(row_idx + radius_) + radius_;
+    std::fill(value_.begin(), value_.end(), 0.0f);
+    std::fill(weight_.begin(), weight_.end(), 0.0f);
+
+    for (int age = 0; age < count_; age++) {
+      const int slot = (head_ - age + frames_) % frames_;
+      BilateralAccumulateRow(
+          ring_[slot].ptr<float>(row_idx + radius_) + radius_, stride, center,
+          src.cols, radius_, closeness_[age].data(), range_table_,
+          value_.data(), weight_.data());
+    }
+
+    float* dst_row = plane_.ptr<float>(row_idx);
+    for (int col_idx = 0; col_idx < src.cols; col_idx++) {
+      dst_row[col_idx] = value_[col_idx] / weight_[col_idx];
+    }
+  }
+
+  // Convert back to the source representation and set the output
+  if (color) {
+    cv::insertChannel(plane_, lab_, 0);
+    cv::cvtColor(lab_, bgr_float_, cv::COLOR_Lab2BGR);
+    bgr_float_.convertTo(dst, CV_8UC3, 255);
+  } else {
+    plane_.convertTo(dst, CV_8U);
+  }
+
+  return true;
+}
+}
@@ -0,0 +1,89 @@
+/** Interface file for spatio-temporal (video) bilateral denoising
+ *
+ *  \file ipcv/bilateral_filtering/VideoBilateralDenoiser.h
+ *  \author Anthony Guarino (ag4933@rit.edu)
+ *  \date 16 Oct 2026
+ */
+
+#pragma once
+
+#include <vector>
+
+#include <opencv2/core.hpp>
+
+#include "BilateralFilter.h"
+#include "BilateralKernel.h"
+
+namespace ipcv {
+
+/** Stateful bilateral denoiser for a stream of equally sized frames
+ *
+ *  The lightness (CV_8UC3 frames) or intensity (CV_8UC1 frames) of the last
+ *  few frames is kept in a ring buffer, padded by the filter radius.  Every
+ *  output pixel is the bilateral average over a (2r+1)x(2r+1) window in each
+ *  buffered frame, with an additional Gaussian weight on frame age, so
+ *  static content is averaged over time while moving edges are rejected by
+ *  the range kernel.  All buffers are allocated on the first frame (or when
+ *  the frame size or type changes) and reused afterwards.
+ */
+class VideoBilateralDenoiser {
+ public:
+  /** Create a denoiser
+   *
+   *  \param[in] sigma_distance  standard deviation of distance/closeness
+   *                             filter
+   *  \param[in] sigma_range     standard deviation of range/similarity filter
+   *  \param[in] radius          radius of the bilateral filter (if negative,
+   *                             use twice the standard deviation of the
+   *                             distance/closeness filter)
+   *  \param[in] frames          number of frames (including the current one)
+   *                             held in the ring buffer
+   *  \param[in] sigma_time      standard deviation of the temporal filter,
+   *                             in frames
+   *  \param[in] border_mode     pixel extrapolation method
+   *  \param[in] border_value    value to use for constant border mode
+   */
+  VideoBilateralDenoiser(const double sigma_distance, const double sigma_range,
+                         const int radius, const int frames = 3,
+                         const double sigma_time = 1.0,
+                         const BorderMode border_mode = BorderMode::REPLICATE,
+                         uint8_t border_value = 0);
+
+  /** Denoise the next frame of the stream
+   *
+   *  \param[in] src   source frame, cv::Mat of CV_8UC3 or CV_8UC1
+   *  \param[out] dst  destination frame of the same size and type as src
+   */
+  bool Denoise(const cv::Mat& src, cv::Mat& dst);
+
+  /** Forget every buffered frame (e.g. at a scene cut) */
+  void Reset();
+
+ private:
+  void Allocate(const cv::Mat& src);
+
+  int radius_;
+  int frames_;
+  BorderMode border_mode_;
+  uint8_t border_value_;
+  double sigma_range_;
+
+  // Closeness weights of every frame age, premultiplied by the temporal
+  // weight
+  std::vector<std::vector<float>> closeness_;
+  RangeKernelTable range_table_;
+  float border_level_;
+
+  // Ring buffer of padded lightness (or intensity) planes
+  std::vector<cv::Mat> ring_;
+  int head_;
+  int count_;
+
+  // Per-frame scratch buffers
+  cv::Mat bgr_float_;
+  cv::Mat lab_;
+  cv::Mat plane_;
+  std::vector<float> value_;
+  std::vector<float> weight_;
+};
+}
@@ -1,12 +1,15 @@
-#include <ctime>
+#include <chrono>
 #include <iostream>
 
 #include <boost/filesystem.hpp>
 #include <boost/program_options.hpp>
 #include <opencv2/core.hpp>
 #include <opencv2/highgui.hpp>
+#include <opencv2/videoio.hpp>
 
 #include "imgs/ipcv/bilateral_filtering/BilateralFilter.h"
+#include "imgs/ipcv/bilateral_filtering/JointBilateralUpsample.h"
+#include "imgs/ipcv/bilateral_filtering/VideoBilateralDenoiser.h"
 
 using namespace std;
 
@@ -16,9 +19,20 @@ int main(int argc, char* argv[]) {
   bool verbose = false;
   string src_filename = "";
   string dst_filename = "";
+  string luminance_filename = "";
+  bool grayscale = false;
+  int upsample_factor = 1;
+  bool upsample_report = false;
+  bool video = false;
+  int temporal_frames = 3;
+  double sigma_time = 1;
   double sigma_distance = 5;
   double sigma_range = 50;
   int filter_radius = -1;
+  string method_string = "exact";
+  double grid_accuracy = 1;
+  string border_mode_string = "replicate";
+  int value = 0;
 
   po::options_description options("Options");
   options.add_options()("help,h", "display this message")(
@@ -32,7 +46,37 @@ int main(int argc, char* argv[]) {
       "range filter standard deviation")(
       "radius,R", po::value<int>(&filter_radius),
       "filter radius (if negative, use twice the standard deviation of the "
-      "distance filter) [default is -1]");
+      "distance filter) [default is -1]")(
+      "method,m", po::value<string>(&method_string),
+      "filtering method (exact|grid) [default is exact]")(
+      "grid-accuracy,a", po::value<double>(&grid_accuracy),
+      "grid cells per standard deviation for the grid method (larger is "
+      "more accurate but slower) [default is 1]")(
+      "border-mode,b", po::value<string>(&border_mode_string),
+      "border mode (constant|replicate) [default is replicate]")(
+      "border-value,V", po::value<int>(&value),
+      "border value for constant border mode [default is 0]")(
+      "grayscale,g", po::bool_switch(&grayscale),
+      "filter the intensity of the source directly, keeping its bit depth "
+      "[default is color]")(
+      "luminance-filename,l", po::value<string>(&luminance_filename),
+      "precomputed luminance plane of the color source, filtered in place "
+      "of the Lab lightness [default is empty]")(
+      "upsample-factor,u", po::value<int>(&upsample_factor),
+      "filter at 1/factor resolution and joint bilateral upsample the "
+      "result [default is 1, full resolution]")(
+      "upsample-report", po::bool_switch(&upsample_report),
+      "report quality and speed of joint bilateral upsampling at factors "
+      "2, 4 and 8 against the exact filter")(
+      "video", po::bool_switch(&video),
+      "treat the source as a video, denoise it frame by frame with the "
+      "spatio-temporal filter and report the sustained frame rate "
+      "[default is image]")(
+      "temporal-frames,n", po::value<int>(&temporal_frames),
+      "number of frames averaged by the spatio-temporal filter "
+      "[default is 3]")(
+      "sigma-time,t", po::value<double>(&sigma_time),
+      "temporal filter standard deviation in frames [default is 1]");
 
   po::positional_options_description positional_options;
   positional_options.add("source-filename", -1);
@@ -56,10 +100,118 @@ int main(int argc, char* argv[]) {
     return EXIT_FAILURE;
   }
 
-  cv::Mat src = cv::imread(src_filename, cv::IMREAD_COLOR);
+  if (!luminance_filename.empty() &&
+      !boost::filesystem::exists(luminance_filename)) {
+    cerr << "Provided luminance file does not exists" << endl;
+    return EXIT_FAILURE;
+  }
+
+  cv::Mat src = cv::imread(src_filename, grayscale ? cv::IMREAD_GRAYSCALE |
+                                                         cv::IMREAD_ANYDEPTH
+                                                   : cv::IMREAD_COLOR);
+
+  cv::Mat luminance;
+  if (!luminance_filename.empty()) {
+    luminance = cv::imread(luminance_filename, cv::IMREAD_GRAYSCALE);
+  }
 
   ipcv::BorderMode border_mode;
-  border_mode = ipcv::BorderMode::REPLICATE;
+  if (border_mode_string == "constant") {
+    border_mode = ipcv::BorderMode::CONSTANT;
+  } else if (border_mode_string == "replicate") {
+    border_mode = ipcv::BorderMode::REPLICATE;
+  } else {
+    cerr << "*** ERROR *** ";
+    cerr << "Provided border mode is not supported" << endl;
+    return EXIT_FAILURE;
+  }
+  if (value < 0 || value > 255) {
+    cerr << "*** ERROR *** ";
+    cerr << "Provided border value must be in the range [0, 255]" << endl;
+    return EXIT_FAILURE;
+  }
+  uint8_t border_value = value;
+
+  if (video) {
+    cv::VideoCapture capture(src_filename);
+    if (!capture.isOpened()) {
+      cerr << "*** ERROR *** ";
+      cerr << "Provided source video could not be opened" << endl;
+      return EXIT_FAILURE;
+    }
+
+    if (verbose) {
+      cout << "Source filename: " << src_filename << endl;
+      cout << "Distance filter standard deviation: " << sigma_distance << endl;
+      cout << "Range filter standard deviation: " << sigma_range << endl;
+      cout << "Filter radius: " << filter_radius << endl;
+      cout << "Temporal frames: " << temporal_frames << endl;
+      cout << "Temporal filter standard deviation: " << sigma_time << endl;
+      cout << "Border mode: " << border_mode_string << endl;
+      cout << "Border value: " << value << endl;
+      cout << "Destination filename: " << dst_filename << endl;
+    }
+
+    ipcv::VideoBilateralDenoiser denoiser(sigma_distance, sigma_range,
+                                          filter_radius, temporal_frames,
+                                          sigma_time, border_mode,
+                                          border_value);
+    cv::VideoWriter writer;
+    cv::Mat frame, dst;
+
+    // The first frame allocates every buffer, so only the following frames
+    // count towards the sustained rate
+    int frames = 0;
+    double seconds = 0;
+    while (capture.read(frame)) {
+      auto start_time = chrono::steady_clock::now();
+      if (!denoiser.Denoise(frame, dst)) {
+        cerr << "*** ERROR *** ";
+        cerr << "Provided video frame type is not supported" << endl;
+        return EXIT_FAILURE;
+      }
+      auto end_time = chrono::steady_clock::now();
+      if (frames > 0) {
+        seconds += chrono::duration<double>(end_time - start_time).count();
+      }
+      frames++;
+
+      if (dst_filename.empty()) {
+        cv::imshow(src_filename + " [Bilateral Filtered]", dst);
+        if (cv::waitKey(1) == 27) {
+          break;
+        }
+      } else {
+        if (!writer.isOpened()) {
+          writer.open(dst_filename,
+                      cv::VideoWriter::fourcc('M', 'J', 'P', 'G'),
+                      capture.get(cv::CAP_PROP_FPS), dst.size(),
+                      dst.channels() == 3);
+        }
+        writer.write(dst);
+      }
+    }
+
+    cout << "Frames: " << frames << endl;
+    if (frames > 1) {
+      cout << "Sustained rate: " << (frames - 1) / seconds << " [frames/s]"
+           << endl;
+    }
+
+    return EXIT_SUCCESS;
+  }
+
+  ipcv::BilateralOptions filter_options;
+  filter_options.grid_accuracy = grid_accuracy;
+  if (method_string == "exact") {
+    filter_options.method = ipcv::BilateralMethod::EXACT;
+  } else if (method_string == "grid") {
+    filter_options.method = ipcv::BilateralMethod::GRID;
+  } else {
+    cerr << "*** ERROR *** ";
+    cerr << "Provided filtering method is not supported" << endl;
+    return EXIT_FAILURE;
+  }
 
   if (verbose) {
     cout << "Source filename: " << src_filename << endl;
@@ -68,22 +220,78 @@ int main(int argc, char* argv[]) {
     cout << "Distance filter standard deviation: " << sigma_distance << endl;
     cout << "Range filter standard deviation: " << sigma_range << endl;
     cout << "Filter radius: " << filter_radius << endl;
+    cout << "Border mode: " << border_mode_string << endl;
+    cout << "Border value: " << value << endl;
+    if (!luminance_filename.empty()) {
+      cout << "Luminance filename: " << luminance_filename << endl;
+    }
+    cout << "Method: " << method_string << endl;
+    if (upsample_factor > 1) {
+      cout << "Upsample factor: " << upsample_factor << endl;
+    }
+    if (filter_options.method == ipcv::BilateralMethod::GRID) {
+      cout << "Grid accuracy: " << grid_accuracy << endl;
+    }
     cout << "Destination filename: " << dst_filename << endl;
   }
 
+  if (upsample_report) {
+    vector<ipcv::UpsampleQuality> report;
+    if (!ipcv::JointBilateralUpsampleQuality(src, sigma_distance, sigma_range,
+                                             filter_radius, {2, 4, 8},
+                                             report)) {
+      cerr << "*** ERROR *** ";
+      cerr << "Joint bilateral upsampling report failed" << endl;
+      return EXIT_FAILURE;
+    }
+
+    cout << "Joint bilateral upsampling vs. exact filter" << endl;
+    for (const auto& quality : report) {
+      cout << "  Factor: " << quality.factor
+           << "  Exact: " << quality.exact_seconds << " [s]"
+           << "  Upsampled: " << quality.upsample_seconds << " [s]"
+           << "  Speedup: "
+           << quality.exact_seconds / quality.upsample_seconds
+           << "  PSNR: " << quality.psnr << " [dB]"
+           << "  Max error: " << quality.max_error << endl;
+    }
+    return EXIT_SUCCESS;
+  }
+
   cv::Mat dst;
 
-  clock_t startTime = clock();
+  auto startTime = chrono::steady_clock::now();
+
+  bool status = false;
+  if (upsample_factor > 1) {
+    status = ipcv::JointBilateralUpsample(src, dst, sigma_distance,
+                                          sigma_range, filter_radius,
+                                          upsample_factor, border_mode,
+                                          border_value);
+  } else if (luminance.empty()) {
+    status = ipcv::BilateralFilter(src, dst, sigma_distance, sigma_range,
+                                   filter_radius, border_mode, border_value,
+                                   filter_options);
+  } else {
+    status = ipcv::BilateralFilterLuminance(src, luminance, dst,
+                                            sigma_distance, sigma_range,
+                                            filter_radius, border_mode,
+                                            border_value);
+  }
 
-  ipcv::BilateralFilter(src, dst, sigma_distance, sigma_range, filter_radius,
-                        border_mode);
+  auto endTime = chrono::steady_clock::now();
 
-  clock_t endTime = clock();
+  if (!status) {
+    cerr << "*** ERROR *** ";
+    cerr << "Provided source, luminance or parameters are not supported"
+         << endl;
+    return EXIT_FAILURE;
+  }
 
   if (verbose) {
     cout << "Elapsed time: "
-         << (endTime - startTime) / static_cast<double>(CLOCKS_PER_SEC)
-         << " [s]" << endl;
+         << chrono::duration<double>(endTime - startTime).count() << " [s]"
+         << endl;
   }
 
   if (dst_filename.empty()) {
@@ -0,0 +1,153 @@
+#include <chrono>
+#include <iostream>
+
+#include <boost/filesystem.hpp>
+#include <boost/program_options.hpp>
+#include <opencv2/core.hpp>
+#include <opencv2/highgui.hpp>
+
+#include "imgs/ipcv/bilateral_filtering/GuidedFilter.h"
+
+using namespace std;
+
+namespace po = boost::program_options;
+
+int main(int argc, char* argv[]) {
+  bool verbose = false;
+  string src_filename = "";
+  string dst_filename = "";
+  string guide_filename = "";
+  bool grayscale = false;
+  int subsample = 1;
+  double sigma_distance = 5;
+  double sigma_range = 50;
+  int filter_radius = -1;
+  string border_mode_string = "replicate";
+  int value = 0;
+
+  po::options_description options("Options");
+  options.add_options()("help,h", "display this message")(
+      "verbose,v", po::bool_switch(&verbose), "verbose [default is silent]")(
+      "source-filename,i", po::value<string>(&src_filename), "source filename")(
+      "destination-filename,o", po::value<string>(&dst_filename),
+      "destination filename")("sigma-distance,d",
+                              po::value<double>(&sigma_distance),
+                              "distance standard deviation (sets the radius "
+                              "when it is negative)")(
+      "sigma-range,r", po::value<double>(&sigma_range),
+      "range standard deviation (the regularization is its square)")(
+      "radius,R", po::value<int>(&filter_radius),
+      "filter radius (if negative, use twice the standard deviation of the "
+      "distance filter) [default is -1]")(
+      "border-mode,b", po::value<string>(&border_mode_string),
+      "border mode (constant|replicate) [default is replicate]")(
+      "border-value,V", po::value<int>(&value),
+      "border value for constant border mode [default is 0]")(
+      "grayscale,g", po::bool_switch(&grayscale),
+      "filter the intensity of the source directly, keeping its bit depth "
+      "[default is color]")(
+      "guide-filename,G", po::value<string>(&guide_filename),
+      "guide image of the size of the source [default is empty, every "
+      "channel of the source guides itself]")(
+      "subsample,s", po::value<int>(&subsample),
+      "fast guided filter subsampling factor [default is 1, exact]");
+
+  po::positional_options_description positional_options;
+  positional_options.add("source-filename", -1);
+
+  po::variables_map vm;
+  po::store(po::command_line_parser(argc, argv)
+                .options(options)
+                .positional(positional_options)
+                .run(),
+            vm);
+  po::notify(vm);
+
+  if (vm.count("help")) {
+    cout << "Usage: " << argv[0] << " [options] source-filename" << endl;
+    cout << options << endl;
+    return EXIT_SUCCESS;
+  }
+
+  if (!boost::filesystem::exists(src_filename)) {
+    cerr << "Provided source file does not exists" << endl;
+    return EXIT_FAILURE;
+  }
+
+  if (!guide_filename.empty() && !boost::filesystem::exists(guide_filename)) {
+    cerr << "Provided guide file does not exists" << endl;
+    return EXIT_FAILURE;
+  }
+
+  cv::Mat src = cv::imread(src_filename, grayscale ? cv::IMREAD_GRAYSCALE |
+                                                         cv::IMREAD_ANYDEPTH
+                                                   : cv::IMREAD_COLOR);
+
+  cv::Mat guide;
+  if (!guide_filename.empty()) {
+    guide = cv::imread(guide_filename, cv::IMREAD_UNCHANGED);
+  }
+
+  ipcv::BorderMode border_mode;
+  if (border_mode_string == "constant") {
+    border_mode = ipcv::BorderMode::CONSTANT;
+  } else if (border_mode_string == "replicate") {
+    border_mode = ipcv::BorderMode::REPLICATE;
+  } else {
+    cerr << "*** ERROR *** ";
+    cerr << "Provided border mode is not supported" << endl;
+    return EXIT_FAILURE;
+  }
+  if (value < 0 || value > 255) {
+    cerr << "*** ERROR *** ";
+    cerr << "Provided border value must be in the range [0, 255]" << endl;
+    return EXIT_FAILURE;
+  }
+  uint8_t border_value = value;
+
+  if (verbose) {
+    cout << "Source filename: " << src_filename << endl;
+    cout << "Size: " << src.size() << endl;
+    cout << "Channels: " << src.channels() << endl;
+    cout << "Distance standard deviation: " << sigma_distance << endl;
+    cout << "Range standard deviation: " << sigma_range << endl;
+    cout << "Filter radius: " << filter_radius << endl;
+    cout << "Border mode: " << border_mode_string << endl;
+    cout << "Border value: " << value << endl;
+    if (!guide_filename.empty()) {
+      cout << "Guide filename: " << guide_filename << endl;
+    }
+    cout << "Subsample factor: " << subsample << endl;
+    cout << "Destination filename: " << dst_filename << endl;
+  }
+
+  cv::Mat dst;
+
+  auto startTime = chrono::steady_clock::now();
+
+  if (!ipcv::GuidedFilter(src, guide, dst, sigma_distance, sigma_range,
+                          filter_radius, subsample, border_mode,
+                          border_value)) {
+    cerr << "*** ERROR *** ";
+    cerr << "Provided source, guide or parameters are not supported" << endl;
+    return EXIT_FAILURE;
+  }
+
+  auto endTime = chrono::steady_clock::now();
+
+  if (verbose) {
+    cout << "Elapsed time: "
+         << chrono::duration<double>(endTime - startTime).count() << " [s]"
+         << endl;
+  }
+
+  if (dst_filename.empty()) {
+    cv::imshow(src_filename, src);
+    cv::imshow(src_filename + " [Guided Filtered]", dst);
+    cv::waitKey(0);
+  } else {
+    cv::imwrite(dst_filename, dst);
+  }
+
+  return EXIT_SUCCESS;
+}
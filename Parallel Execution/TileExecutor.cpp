@@ -0,0 +1,255 @@
+/** Implementation file for the tiled, multi-threaded neighbourhood-operation
+ *  executor
+ *
+ *  \file ipcv/parallel/TileExecutor.cpp
+ *  \author Anthony Guarino (ag4933@rit.edu)
+ *  \date 16 Oct 2026
+ */
+
+#include "TileExecutor.h"
+
+#include <algorithm>
+#include <vector>
+
+using namespace std;
+
+namespace ipcv {
+
+// Default number of destination pixels across a tile of an in-memory source
+static const int kTileWidth = 512;
+
+// Fewest destination rows and columns in a tile (smaller tiles spend more
+// time reading halo than doing work)
+static const int kMinTileRows = 8;
+static const int kMinTileCols = 64;
+
+// Tiles per worker an in-memory source is split into at least, so that
+// stealing can even out the load
+static const int kTilesPerWorker = 4;
+
+/** Destination rows of a tile whose source (with halo) fits the cache
+ *
+ *  \param[in] options  tiling settings
+ *  \param[in] size     size of the image
+ *  \param[in] type     OpenCV type of the image
+ *  \param[in] halo     source pixels read beyond each side of a tile
+ *  \param[in] width    destination pixels across the tile
+ */
+static int FitTileHeight(const TileOptions& options, const cv::Size& size,
+                         const int type, const TileHalo& halo,
+                         const int width) {
+  if (options.tile_height > 0) {
+    return std::min(options.tile_height, size.height);
+  }
+
+  const size_t row_bytes =
+      static_cast<size_t>(width + halo.left + halo.right) * CV_ELEM_SIZE(type);
+  const int rows = static_cast<int>(options.cache_bytes / row_bytes) -
+                   halo.top - halo.bottom;
+  return std::max(1, std::min(std::max(rows, kMinTileRows), size.height));
+}
+
+/** Extrapolate the part of a grown rect lying outside the image
+ *
+ *  \param[in] src     source cv::Mat
+ *  \param[in] grown   source rect needed (may leave the image)
+ *  \param[in] border  extrapolation of the source beyond the image
+ *  \param[out] tile   source pixels of grown
+ */
+static void ExtrapolateTile(const cv::Mat& src, const cv::Rect& grown,
+                            const TileBorder& border, cv::Mat& tile) {
+  const cv::Rect inside = grown & cv::Rect(0, 0, src.cols, src.rows);
+  cv::copyMakeBorder(src(inside), tile, inside.y - grown.y,
+                     (grown.y + grown.height) - (inside.y + inside.height),
+                     inside.x - grown.x,
+                     (grown.x + grown.width) - (inside.x + inside.width),
+                     border.type | cv::BORDER_ISOLATED, border.value);
+}
+
+/** Start the workers
+ *
+ *  \param[in] options  tiling and threading settings
+ */
+TileExecutor::TileExecutor(const TileOptions& options)
+    : options_(options), pool_(options.threads) {}
+
+/** Destination tile size used for a source of the given size and type
+ *
+ *  \param[in] size  size of the image
+ *  \param[in] type  OpenCV type of the image
+ *  \param[in] halo  source pixels read beyond each side of a tile
+ */
+cv::Size TileExecutor::TileSize(const cv::Size& size, const int type,
+                                const TileHalo& halo) const {
+  const int width = std::min(
+      (options_.tile_width > 0) ? options_.tile_width : kTileWidth,
+      size.width);
+  int height = FitTileHeight(options_, size, type, halo, width);
+
+  // Shorten the tiles until every worker has a few of them
+  if (options_.tile_height <= 0) {
+    const int columns = (size.width + width - 1) / width;
+    const int wanted_rows =
+        (kTilesPerWorker * Threads() + columns - 1) / columns;
+    const int rows = (size.height + height - 1) / height;
+    if (rows < wanted_rows) {
+      height = std::max(std::min(kMinTileRows, size.height),
+                        (size.height + wanted_rows - 1) / wanted_rows);
+    }
+  }
+
+  return cv::Size(width, height);
+}
+
+/** Run a neighbourhood operation over an in-memory source
+ *
+ *  \param[in] src     source cv::Mat
+ *  \param[in] halo    source pixels read beyond each side of a tile
+ *  \param[in] border  extrapolation of the source beyond the image
+ *  \param[in] body    work on one tile
+ */
+void TileExecutor::Run(const cv::Mat& src, const TileHalo& halo,
+                       const TileBorder& border, const TileBody& body) {
+  if (src.empty()) {
+    return;
+  }
+
+  const cv::Size tile_size = TileSize(src.size(), src.type(), halo);
+  const int columns = (src.cols + tile_size.width - 1) / tile_size.width;
+  const int rows = (src.rows + tile_size.height - 1) / tile_size.height;
+  const cv::Rect image(0, 0, src.cols, src.rows);
+
+  vector<cv::Mat> scratch(Threads());
+  pool_.Run(columns * rows, [&](int index, int worker) {
+    const int x = (index % columns) * tile_size.width;
+    const int y = (index / columns) * tile_size.height;
+    const cv::Rect rect(x, y, std::min(tile_size.width, src.cols - x),
+                        std::min(tile_size.height, src.rows - y));
+    const cv::Rect grown(rect.x - halo.left, rect.y - halo.top,
+                         rect.width + halo.left + halo.right,
+                         rect.height + halo.top + halo.bottom);
+
+    if ((grown & image) == grown) {
+      body(src(grown), rect, worker);
+    } else {
+      ExtrapolateTile(src, grown, border, scratch[worker]);
+      body(scratch[worker], rect, worker);
+    }
+  });
+}
+
+/** Run a neighbourhood operation over a streaming source
+ *
+ *  \param[in] source     streaming source
+ *  \param[in] halo       source pixels read beyond each side of a tile
+ *  \param[in] border     extrapolation of the source beyond the image
+ *  \param[in] body       work on one tile
+ *  \param[in] rows_done  called as rows_done(first_row, rows) when the
+ *                        destination rows of a band are complete
+ */
+bool TileExecutor::Run(TileSource& source, const TileHalo& halo,
+                       const TileBorder& border, const TileBody& body,
+                       const function<void(int, int)>& rows_done) {
+  const cv::Size size = source.Size();
+  const int type = source.Type();
+  if (size.area() == 0) {
+    return true;
+  }
+
+  // Only one band is in memory, so its tiles are as wide as it takes to
+  // give every worker one
+  int width = options_.tile_width;
+  if (width <= 0) {
+    width = std::max(kMinTileCols, (size.width + Threads() - 1) / Threads());
+  }
+  width = std::min(width, size.width);
+  const int band_height = FitTileHeight(options_, size, type, halo, width);
+  const int columns = (size.width + width - 1) / width;
+  const int padded_cols = size.width + halo.left + halo.right;
+
+  // Padded source rows of the current and the previous band; window row i
+  // holds padded row first_row - halo.top + i
+  cv::Mat window, previous, chunk, padded_chunk;
+  int previous_first = 0, previous_rows = 0;
+  int next_row = 0;
+
+  for (int first_row = 0; first_row < size.height; first_row += band_height) {
+    const int band_rows = std::min(band_height, size.height - first_row);
+    const int window_rows = band_rows + halo.top + halo.bottom;
+    const int window_first = first_row - halo.top;
+    std::swap(window, previous);
+    window.create(window_rows, padded_cols, type);
+
+    // Rows shared with the previous band
+    int filled_end = window_first;
+    if (previous_rows > 0) {
+      const int previous_first_padded = previous_first - halo.top;
+      const int previous_end = previous_first_padded + previous_rows;
+      const int shared_begin = std::max(window_first, previous_first_padded);
+      const int shared_end = std::min(window_first + window_rows, previous_end);
+      if (shared_end > shared_begin) {
+        cv::Mat shared =
+            window.rowRange(shared_begin - window_first,
+                            shared_end - window_first);
+        previous
+            .rowRange(shared_begin - previous_first_padded,
+                      shared_end - previous_first_padded)
+            .copyTo(shared);
+        filled_end = shared_end;
+      }
+    }
+
+    // New rows from the source, padded left and right
+    const int read_begin = std::max(std::max(filled_end, 0), next_row);
+    const int read_end = std::min(window_first + window_rows, size.height);
+    if (read_end > read_begin) {
+      chunk.create(read_end - read_begin, size.width, type);
+      if (!source.Read(chunk)) {
+        return false;
+      }
+      next_row = read_end;
+      cv::copyMakeBorder(chunk, padded_chunk, 0, 0, halo.left, halo.right,
+                         border.type | cv::BORDER_ISOLATED, border.value);
+      cv::Mat rows = window.rowRange(read_begin - window_first,
+                                     read_end - window_first);
+      padded_chunk.copyTo(rows);
+    }
+
+    // Rows above and below the image
+    for (int i = 0; i < window_rows; i++) {
+      const int padded_row = window_first + i;
+      if (padded_row >= 0 && padded_row < size.height) {
+        continue;
+      }
+      cv::Mat row = window.row(i);
+      if (border.type == cv::BORDER_CONSTANT) {
+        row = border.value;
+      } else {
+        const int edge = (padded_row < 0) ? 0 : size.height - 1;
+        window.row(edge - window_first).copyTo(row);
+      }
+    }
+
+    pool_.Run(columns, [&](int index, int worker) {
+      const int x = index * width;
+      const cv::Rect rect(x, first_row, std::min(width, size.width - x),
+                          band_rows);
+      const cv::Mat tile = window(cv::Rect(
+          x, 0, rect.width + halo.left + halo.right, window_rows));
+      body(tile, rect, worker);
+    });
+
+    rows_done(first_row, band_rows);
+    previous_first = first_row;
+    previous_rows = window_rows;
+  }
+
+  return true;
+}
+
+/** Executor shared by the neighbourhood operations of the library */
+TileExecutor& SharedTileExecutor() {
+  static TileExecutor executor;
+  return executor;
+}
+}
@@ -0,0 +1,162 @@
+/** Interface file for the tiled, multi-threaded neighbourhood-operation
+ *  executor
+ *
+ *  \file ipcv/parallel/TileExecutor.h
+ *  \author Anthony Guarino (ag4933@rit.edu)
+ *  \date 16 Oct 2026
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+#include <opencv2/core.hpp>
+
+#include "WorkStealingPool.h"
+
+namespace ipcv {
+
+/** Number of source pixels a neighbourhood operation reads beyond each
+ *  side of the destination pixels it writes
+ */
+struct TileHalo {
+  int top = 0;
+  int bottom = 0;
+  int left = 0;
+  int right = 0;
+};
+
+/** How the source is extrapolated where a halo leaves the image
+ *
+ *  \var type   cv::BORDER_CONSTANT or cv::BORDER_REPLICATE
+ *  \var value  value of every channel for cv::BORDER_CONSTANT
+ */
+struct TileBorder {
+  int type = cv::BORDER_REPLICATE;
+  cv::Scalar value = cv::Scalar::all(0);
+};
+
+/** Tiling and threading settings
+ *
+ *  \var threads      number of workers (0 uses one per hardware thread)
+ *  \var cache_bytes  source bytes (tile and halo) each tile is sized to
+ *                    fit in, about the size of a per-core L2 cache
+ *  \var tile_width   destination pixels across a tile (0 derives it from
+ *                    cache_bytes)
+ *  \var tile_height  destination rows in a tile (0 derives it from
+ *                    cache_bytes)
+ */
+struct TileOptions {
+  int threads = 0;
+  std::size_t cache_bytes = 256 * 1024;
+  int tile_width = 0;
+  int tile_height = 0;
+};
+
+/** Source read strictly from top to bottom, a few rows at a time (e.g. a
+ *  decoder or a file too large to hold in memory)
+ */
+class TileSource {
+ public:
+  virtual ~TileSource() {}
+
+  /** Size of the whole image */
+  virtual cv::Size Size() const = 0;
+
+  /** OpenCV type of the image */
+  virtual int Type() const = 0;
+
+  /** Read the next rows.rows rows of the image
+   *
+   *  \param[out] rows  cv::Mat of Size().width columns and Type(), already
+   *                    allocated
+   */
+  virtual bool Read(cv::Mat& rows) = 0;
+};
+
+/** Work on one tile
+ *
+ *  Called as body(tile, rect, worker): tile holds the source pixels of
+ *  rect grown by the halo (extrapolated where it leaves the image), so
+ *  destination pixel (rect.y + i, rect.x + j) is centered on tile pixel
+ *  (halo.top + i, halo.left + j); worker, in [0, Threads()), identifies the
+ *  calling worker for per-worker scratch buffers.  Tiles never overlap, so
+ *  bodies may write their rect of a shared destination without locking.
+ */
+using TileBody =
+    std::function<void(const cv::Mat&, const cv::Rect&, const int)>;
+
+/** Splits a destination into cache-sized tiles, gives each tile the halo
+ *  of source it needs and runs the tiles on a work-stealing thread pool
+ */
+class TileExecutor {
+ public:
+  /** Start the workers
+   *
+   *  \param[in] options  tiling and threading settings
+   */
+  explicit TileExecutor(const TileOptions& options = TileOptions());
+
+  /** Run a neighbourhood operation over an in-memory source
+   *
+   *  Tiles away from the image edges see the source directly (no copy);
+   *  tiles whose halo leaves the image get an extrapolated copy.
+   *
+   *  \param[in] src     source cv::Mat (any type)
+   *  \param[in] halo    source pixels read beyond each side of a tile
+   *  \param[in] border  extrapolation of the source beyond the image
+   *  \param[in] body    work on one tile
+   */
+  void Run(const cv::Mat& src, const TileHalo& halo, const TileBorder& border,
+           const TileBody& body);
+
+  /** Run a neighbourhood operation over a streaming source
+   *
+   *  The source is read one band of tile rows (plus halo) at a time, so only
+   *  a band is ever held in memory; the tiles of a band run in parallel and
+   *  rows_done is called once all of them are done, in order from the top.
+   *
+   *  \param[in] source     streaming source
+   *  \param[in] halo       source pixels read beyond each side of a tile
+   *  \param[in] border     extrapolation of the source beyond the image
+   *  \param[in] body       work on one tile
+   *  \param[in] rows_done  called as rows_done(first_row, rows) when the
+   *                        destination rows of a band are complete
+   */
+  bool Run(TileSource& source, const TileHalo& halo, const TileBorder& border,
+           const TileBody& body,
+           const std::function<void(int, int)>& rows_done);
+
+  /** Run count independent tasks on the workers, for work whose source is
+   *  not a neighborhood of its destination tile
+   *
+   *  \param[in] count  number of tasks
+   *  \param[in] task   called as task(index, worker)
+   */
+  void Run(const int count, const std::function<void(int, int)>& task) {
+    pool_.Run(count, task);
+  }
+
+  /** Number of workers */
+  int Threads() const { return pool_.Threads(); }
+
+  /** Destination tile size used for a source of the given size and type
+   *
+   *  \param[in] size  size of the image
+   *  \param[in] type  OpenCV type of the image
+   *  \param[in] halo  source pixels read beyond each side of a tile
+   */
+  cv::Size TileSize(const cv::Size& size, const int type,
+                    const TileHalo& halo) const;
+
+ private:
+  TileOptions options_;
+  WorkStealingPool pool_;
+};
+
+/** Executor shared by the neighbourhood operations of the library (one
+ *  worker per hardware thread, started on first use)
+ */
+TileExecutor& SharedTileExecutor();
+}
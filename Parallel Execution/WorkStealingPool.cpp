@@ -0,0 +1,216 @@
+/** Implementation file for a work-stealing thread pool
+ *
+ *  \file ipcv/parallel/WorkStealingPool.cpp
+ *  \author Anthony Guarino (ag4933@rit.edu)
+ *  \date 16 Oct 2026
+ */
+
+#include "WorkStealingPool.h"
+
+#include <algorithm>
+
+using namespace std;
+
+namespace ipcv {
+
+// Pool whose batch the current thread is running a task of (and the worker
+// it runs as), so that a nested Run on that pool runs inline
+static thread_local const WorkStealingPool* current_pool = nullptr;
+static thread_local int current_worker = 0;
+
+/** Mark the current thread as a worker of a pool for its lifetime */
+class CurrentWorker {
+ public:
+  CurrentWorker(const WorkStealingPool* pool, const int worker)
+      : pool_(current_pool), worker_(current_worker) {
+    current_pool = pool;
+    current_worker = worker;
+  }
+
+  ~CurrentWorker() {
+    current_pool = pool_;
+    current_worker = worker_;
+  }
+
+ private:
+  const WorkStealingPool* pool_;
+  int worker_;
+};
+
+/** Start the workers
+ *
+ *  \param[in] threads  number of workers, including the calling thread
+ */
+WorkStealingPool::WorkStealingPool(const int threads) {
+  int count = threads;
+  if (count <= 0) {
+    count = std::max(1, static_cast<int>(thread::hardware_concurrency()));
+  }
+
+  for (int worker = 0; worker < count; worker++) {
+    queues_.emplace_back(new Queue);
+  }
+  for (int worker = 1; worker < count; worker++) {
+    threads_.emplace_back(&WorkStealingPool::WorkerLoop, this, worker);
+  }
+}
+
+/** Stop and join the workers */
+WorkStealingPool::~WorkStealingPool() {
+  {
+    lock_guard<mutex> lock(mutex_);
+    stop_ = true;
+  }
+  start_.notify_all();
+  for (auto& thread : threads_) {
+    thread.join();
+  }
+}
+
+/** Take the next task of a worker, stealing from the others when its own
+ *  queue is empty
+ *
+ *  \param[in] worker  index of the worker
+ *  \param[out] index  task index
+ */
+bool WorkStealingPool::Pop(const int worker, int& index) {
+  {
+    Queue& own = *queues_[worker];
+    lock_guard<mutex> lock(own.mutex);
+    if (!own.tasks.empty()) {
+      index = own.tasks.front();
+      own.tasks.pop_front();
+      return true;
+    }
+  }
+
+  const int count = Threads();
+  for (int offset = 1; offset < count; offset++) {
+    Queue& victim = *queues_[(worker + offset) % count];
+    lock_guard<mutex> lock(victim.mutex);
+    if (!victim.tasks.empty()) {
+      index = victim.tasks.back();
+      victim.tasks.pop_back();
+      return true;
+    }
+  }
+
+  return false;
+}
+
+/** Drop every task not yet started */
+void WorkStealingPool::Clear() {
+  for (auto& queue : queues_) {
+    lock_guard<mutex> lock(queue->mutex);
+    queue->tasks.clear();
+  }
+}
+
+/** Run tasks until every queue is empty, keeping the first exception thrown
+ *  by a task and dropping the rest of the batch after it
+ *
+ *  \param[in] worker  index of the worker
+ */
+void WorkStealingPool::Drain(const int worker) {
+  int index;
+  while (Pop(worker, index)) {
+    try {
+      (*task_)(index, worker);
+    } catch (...) {
+      {
+        lock_guard<mutex> lock(mutex_);
+        if (!error_) {
+          error_ = current_exception();
+        }
+      }
+      Clear();
+    }
+  }
+}
+
+/** Wait for batches and help drain them
+ *
+ *  \param[in] worker  index of the worker
+ */
+void WorkStealingPool::WorkerLoop(const int worker) {
+  CurrentWorker current(this, worker);
+  unsigned long seen = 0;
+  for (;;) {
+    {
+      unique_lock<mutex> lock(mutex_);
+      start_.wait(lock, [&] { return stop_ || generation_ != seen; });
+      if (stop_) {
+        return;
+      }
+      seen = generation_;
+    }
+
+    Drain(worker);
+
+    {
+      lock_guard<mutex> lock(mutex_);
+      busy_--;
+    }
+    done_.notify_all();
+  }
+}
+
+/** Run count tasks and return once all of them are done
+ *
+ *  \param[in] count  number of tasks
+ *  \param[in] task   called as task(index, worker) for every index
+ */
+void WorkStealingPool::Run(const int count,
+                           const function<void(int, int)>& task) {
+  if (count <= 0) {
+    return;
+  }
+
+  // A task of this pool's batch runs its nested batch itself, as the pool
+  // only runs one batch at a time
+  if (current_pool == this) {
+    for (int index = 0; index < count; index++) {
+      task(index, current_worker);
+    }
+    return;
+  }
+
+  lock_guard<mutex> run_lock(run_mutex_);
+  CurrentWorker current(this, 0);
+
+  // Deal the tasks out in contiguous runs
+  const int workers = Threads();
+  for (int worker = 0; worker < workers; worker++) {
+    Queue& queue = *queues_[worker];
+    lock_guard<mutex> lock(queue.mutex);
+    for (int index = worker * count / workers;
+         index < (worker + 1) * count / workers; index++) {
+      queue.tasks.push_back(index);
+    }
+  }
+
+  {
+    lock_guard<mutex> lock(mutex_);
+    task_ = &task;
+    busy_ = workers - 1;
+    generation_++;
+  }
+  start_.notify_all();
+
+  Drain(0);
+
+  // Every queue is empty once worker 0 runs dry, but stolen tasks may
+  // still be running on the other workers
+  exception_ptr error;
+  {
+    unique_lock<mutex> lock(mutex_);
+    done_.wait(lock, [&] { return busy_ == 0; });
+    task_ = nullptr;
+    swap(error, error_);
+  }
+
+  if (error) {
+    rethrow_exception(error);
+  }
+}
+}
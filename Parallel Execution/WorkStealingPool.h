@@ -0,0 +1,85 @@
+/** Interface file for a work-stealing thread pool
+ *
+ *  \file ipcv/parallel/WorkStealingPool.h
+ *  \author Anthony Guarino (ag4933@rit.edu)
+ *  \date 16 Oct 2026
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ipcv {
+
+/** Fixed set of worker threads running batches of indexed tasks
+ *
+ *  Every batch of tasks is dealt out to the workers in contiguous runs
+ *  (neighbouring tiles stay on one core); a worker takes tasks from the
+ *  front of its own queue and, once that is empty, steals from the back of
+ *  the other queues, so uneven tasks still keep every worker busy.  The
+ *  calling thread takes part as worker 0.
+ */
+class WorkStealingPool {
+ public:
+  /** Start the workers
+   *
+   *  \param[in] threads  number of workers, including the calling thread
+   *                      (0 uses one per hardware thread)
+   */
+  explicit WorkStealingPool(const int threads = 0);
+
+  /** Stop and join the workers */
+  ~WorkStealingPool();
+
+  WorkStealingPool(const WorkStealingPool&) = delete;
+  WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+  /** Run count tasks and return once all of them are done
+   *
+   *  Batches are run one at a time; a task that calls Run on the same pool
+   *  runs the nested batch inline on its own worker.  If a task throws, the
+   *  tasks of the batch not yet started are dropped and the first exception
+   *  is rethrown once every worker is idle.
+   *
+   *  \param[in] count  number of tasks
+   *  \param[in] task   called as task(index, worker) for every index in
+   *                    [0, count), worker being in [0, Threads())
+   */
+  void Run(const int count, const std::function<void(int, int)>& task);
+
+  /** Number of workers, including the calling thread */
+  int Threads() const { return static_cast<int>(queues_.size()); }
+
+ private:
+  /** Queue of task indices owned by one worker */
+  struct Queue {
+    std::mutex mutex;
+    std::deque<int> tasks;
+  };
+
+  void WorkerLoop(const int worker);
+  void Drain(const int worker);
+  bool Pop(const int worker, int& index);
+  void Clear();
+
+  std::vector<std::unique_ptr<Queue>> queues_;
+  std::vector<std::thread> threads_;
+
+  std::mutex mutex_;
+  std::mutex run_mutex_;
+  std::condition_variable start_;
+  std::condition_variable done_;
+  const std::function<void(int, int)>* task_ = nullptr;
+  std::exception_ptr error_;
+  unsigned long generation_ = 0;
+  int busy_ = 0;
+  bool stop_ = false;
+};
+}
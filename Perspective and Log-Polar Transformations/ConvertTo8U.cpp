@@ -0,0 +1,40 @@
+/** Implementation file for converting remapped images to 8 bits for display
+ *
+ *  \file ipcv/geometric_transformation/ConvertTo8U.cpp
+ *  \author Anthony Guarino (ag4933@rit.edu)
+ *  \date 16 Oct 2026
+ */
+
+#include "ConvertTo8U.h"
+
+#include <vector>
+
+using namespace std;
+
+namespace ipcv {
+
+/** Convert an image to an 8-bit type for display and compositing
+ *
+ *  \param[in] src    source cv::Mat of CV_8U, CV_16U or CV_32F
+ *  \param[in] type   8-bit type of the destination (CV_8UC1 or CV_8UC3)
+ *  \param[out] dst   destination cv::Mat of CV_8U
+ */
+void ConvertTo8U(const cv::Mat& src, const int type, cv::Mat& dst) {
+  double scale = 1;
+  if (src.depth() == CV_16U) {
+    scale = 255.0 / 65535.0;
+  } else if (src.depth() == CV_32F) {
+    double max_value;
+    cv::minMaxLoc(src.reshape(1), nullptr, &max_value);
+    scale = (max_value > 1) ? 255 / max_value : 255;
+  }
+
+  cv::Mat converted;
+  src.convertTo(converted, CV_8U, scale);
+  if (converted.channels() == 1 && CV_MAT_CN(type) == 3) {
+    cv::merge(vector<cv::Mat>(3, converted), dst);
+  } else {
+    dst = converted;
+  }
+}
+}
@@ -0,0 +1,29 @@
+/** Interface file for converting remapped images to 8 bits for display
+ *
+ *  \file ipcv/geometric_transformation/ConvertTo8U.h
+ *  \author Anthony Guarino (ag4933@rit.edu)
+ *  \date 16 Oct 2026
+ */
+
+#pragma once
+
+#include <opencv2/core.hpp>
+
+namespace ipcv {
+
+/** Convert an image to an 8-bit type for display and compositing
+ *
+ *  CV_16U values are scaled from [0, 65535].  CV_32F values are scaled from
+ *  [0, 1] when no value exceeds 1, and from [0, maximum value] otherwise
+ *  (as for float TIFFs holding raw counts); negative values saturate to 0,
+ *  so a zero border stays zero; other depths are saturated as they are.
+ *  Single-channel images are replicated to 3 channels when type has 3
+ *  channels.
+ *
+ *  \param[in] src    source cv::Mat of CV_8U, CV_16U or CV_32F
+ *  \param[in] type   8-bit type of the destination (CV_8UC1 or CV_8UC3)
+ *  \param[out] dst   destination cv::Mat of CV_8U (of type's channels when
+ *                    src is single-channel, else of src's channels)
+ */
+void ConvertTo8U(const cv::Mat& src, const int type, cv::Mat& dst);
+}
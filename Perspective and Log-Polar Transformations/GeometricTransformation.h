@@ -7,8 +7,14 @@
 
 #pragma once
 
+#include "imgs/ipcv/geometric_transformation/ConvertTo8U.h"
+#include "imgs/ipcv/geometric_transformation/MapCache.h"
 #include "imgs/ipcv/geometric_transformation/MapGCP.h"
 #include "imgs/ipcv/geometric_transformation/MapQ2Q.h"
 #include "imgs/ipcv/geometric_transformation/MapRST.h"
 #include "imgs/ipcv/geometric_transformation/MapPolar.h"
 #include "imgs/ipcv/geometric_transformation/Remap.h"
+#include "imgs/ipcv/geometric_transformation/RemapFixed.h"
+#include "imgs/ipcv/geometric_transformation/Transform.h"
+#include "imgs/ipcv/geometric_transformation/WarpRST.h"
+#include "imgs/ipcv/geometric_transformation/WarpQ2Q.h"
@@ -0,0 +1,262 @@
+/** Implementation file for caching remapping maps on disk
+ *
+ *  \file ipcv/geometric_transformation/MapCache.cpp
+ *  \author Anthony Guarino (ag4933@rit.edu)
+ *  \date 16 Oct 2026
+ */
+
+#include "MapCache.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+using namespace std;
+
+namespace ipcv {
+
+// FNV-1a 64-bit offset basis and prime
+static const uint64_t kFnvOffset = 14695981039346656037ull;
+static const uint64_t kFnvPrime = 1099511628211ull;
+
+// Identifies a map file and the version of its layout
+static const char kMapFileMagic[8] = {'I', 'P', 'C', 'V', 'M', 'A', 'P', '2'};
+
+// Bytes the header and every map are aligned to in a map file
+static const size_t kMapFileAlignment = 64;
+
+/** Header at the start of a map file, followed by the key_size bytes of
+ *  the key
+ */
+struct MapFileHeader {
+  char magic[8];
+  uint64_t key;
+  uint64_t key_size;
+  int32_t rows;
+  int32_t cols;
+  int32_t type1;
+  int32_t type2;
+};
+
+/** Bytes rounded up to a multiple of kMapFileAlignment */
+static size_t Aligned(const size_t bytes) {
+  return (bytes + kMapFileAlignment - 1) / kMapFileAlignment *
+         kMapFileAlignment;
+}
+
+/** Maps of a file mapped into memory, unmapping it once the last cv::Mat
+ *  referring to it is released (it never allocates)
+ */
+class MappedFileAllocator : public cv::MatAllocator {
+ public:
+#if CV_VERSION_MAJOR >= 4
+  using AccessFlag = cv::AccessFlag;
+#else
+  using AccessFlag = int;
+#endif
+
+  cv::UMatData* allocate(int, const int*, int, void*, size_t*, AccessFlag,
+                         cv::UMatUsageFlags) const override {
+    return nullptr;
+  }
+
+  bool allocate(cv::UMatData*, AccessFlag,
+                cv::UMatUsageFlags) const override {
+    return false;
+  }
+
+  void deallocate(cv::UMatData* u) const override {
+    if (u) {
+      munmap(u->origdata, u->size);
+      delete u;
+    }
+  }
+};
+
+/** The allocator shared by every mapped file */
+static const cv::MatAllocator* MappedAllocator() {
+  static const MappedFileAllocator allocator;
+  return &allocator;
+}
+
+/** Start a key for a transform
+ *
+ *  \param[in] transform  name of the transform type
+ *  \param[in] version    version of the maps the transform computes
+ */
+MapCacheKey::MapCacheKey(const string& transform, const int version)
+    : hash_(kFnvOffset) {
+  AddBytes(transform.data(), transform.size() + 1);
+  Add(version);
+}
+
+/** Add a parameter to the key */
+MapCacheKey& MapCacheKey::Add(const double value) {
+  AddBytes(&value, sizeof(value));
+  return *this;
+}
+
+MapCacheKey& MapCacheKey::Add(const int value) {
+  AddBytes(&value, sizeof(value));
+  return *this;
+}
+
+MapCacheKey& MapCacheKey::Add(const cv::Size& size) {
+  return Add(size.width).Add(size.height);
+}
+
+MapCacheKey& MapCacheKey::Add(const vector<cv::Point>& points) {
+  Add(static_cast<int>(points.size()));
+  for (const auto& point : points) {
+    Add(point.x).Add(point.y);
+  }
+  return *this;
+}
+
+void MapCacheKey::AddBytes(const void* data, const size_t size) {
+  const unsigned char* bytes = static_cast<const unsigned char*>(data);
+  for (size_t i = 0; i < size; i++) {
+    hash_ = (hash_ ^ bytes[i]) * kFnvPrime;
+  }
+  bytes_.append(static_cast<const char*>(data), size);
+}
+
+/** Use a directory of cached maps
+ *
+ *  \param[in] directory  existing directory holding the map files
+ */
+MapCache::MapCache(const string& directory) : directory_(directory) {}
+
+/** Path of the file holding the maps of a key */
+string MapCache::Path(const MapCacheKey& key) const {
+  char name[32];
+  snprintf(name, sizeof(name), "%016llx.map",
+           static_cast<unsigned long long>(key.Value()));
+  return directory_ + "/" + name;
+}
+
+/** Load the maps of a key
+ *
+ *  \param[in] key    key of the maps
+ *  \param[out] map1  cv::Mat of the horizontal (x) coordinates
+ *  \param[out] map2  cv::Mat of the vertical (y) coordinates
+ */
+bool MapCache::Load(const MapCacheKey& key, cv::Mat& map1, cv::Mat& map2) {
+  const int fd = open(Path(key).c_str(), O_RDONLY);
+  if (fd < 0) {
+    return false;
+  }
+
+  struct stat status;
+  if (fstat(fd, &status) != 0 ||
+      static_cast<size_t>(status.st_size) < sizeof(MapFileHeader)) {
+    close(fd);
+    return false;
+  }
+  // Private, so that writes to the maps stay in memory
+  const size_t bytes = status.st_size;
+  void* data =
+      mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (data == MAP_FAILED) {
+    return false;
+  }
+
+  // Accept only a whole file written for this very key
+  unsigned char* file = static_cast<unsigned char*>(data);
+  MapFileHeader header;
+  memcpy(&header, file, sizeof(header));
+  const string& key_bytes = key.Bytes();
+  bool valid = memcmp(header.magic, kMapFileMagic, sizeof(kMapFileMagic)) ==
+                   0 &&
+               header.key == key.Value() &&
+               header.key_size == key_bytes.size() &&
+               bytes >= sizeof(header) + key_bytes.size() &&
+               memcmp(file + sizeof(header), key_bytes.data(),
+                      key_bytes.size()) == 0 &&
+               header.rows > 0 && header.cols > 0;
+  const size_t maps_offset = Aligned(sizeof(header) + key_bytes.size());
+  size_t map1_bytes = 0, map2_bytes = 0;
+  if (valid) {
+    map1_bytes = static_cast<size_t>(header.rows) * header.cols *
+                 CV_ELEM_SIZE(header.type1);
+    map2_bytes = static_cast<size_t>(header.rows) * header.cols *
+                 CV_ELEM_SIZE(header.type2);
+    valid = bytes == maps_offset + Aligned(map1_bytes) + map2_bytes;
+  }
+  if (!valid) {
+    munmap(data, bytes);
+    return false;
+  }
+
+  // Both maps share the mapping, which is released with the last of them
+  cv::UMatData* mapping = new cv::UMatData(MappedAllocator());
+  mapping->data = mapping->origdata = file;
+  mapping->size = bytes;
+  mapping->refcount = 2;
+  map1 = cv::Mat(header.rows, header.cols, header.type1, file + maps_offset);
+  map1.u = mapping;
+  map2 = cv::Mat(header.rows, header.cols, header.type2,
+                 file + maps_offset + Aligned(map1_bytes));
+  map2.u = mapping;
+
+  return true;
+}
+
+/** Store the maps of a key, replacing any cached before
+ *
+ *  \param[in] key   key of the maps
+ *  \param[in] map1  cv::Mat of the horizontal (x) coordinates
+ *  \param[in] map2  cv::Mat of the vertical (y) coordinates (size of map1)
+ */
+bool MapCache::Store(const MapCacheKey& key, const cv::Mat& map1,
+                     const cv::Mat& map2) {
+  if (map1.empty() || map1.size() != map2.size()) {
+    return false;
+  }
+
+  const string& key_bytes = key.Bytes();
+  MapFileHeader header;
+  memcpy(header.magic, kMapFileMagic, sizeof(kMapFileMagic));
+  header.key = key.Value();
+  header.key_size = key_bytes.size();
+  header.rows = map1.rows;
+  header.cols = map1.cols;
+  header.type1 = map1.type();
+  header.type2 = map2.type();
+
+  const string path = Path(key);
+  const string temporary = path + "." + to_string(getpid()) + ".tmp";
+  ofstream file(temporary, ios::binary);
+  if (!file.is_open()) {
+    return false;
+  }
+
+  const vector<char> padding(kMapFileAlignment, 0);
+  const size_t header_bytes = sizeof(header) + key_bytes.size();
+  file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  file.write(key_bytes.data(), key_bytes.size());
+  file.write(padding.data(), Aligned(header_bytes) - header_bytes);
+  for (int row = 0; row < map1.rows; row++) {
+    file.write(map1.ptr<char>(row), map1.cols * map1.elemSize());
+  }
+  const size_t map1_bytes = map1.total() * map1.elemSize();
+  file.write(padding.data(), Aligned(map1_bytes) - map1_bytes);
+  for (int row = 0; row < map2.rows; row++) {
+    file.write(map2.ptr<char>(row), map2.cols * map2.elemSize());
+  }
+  file.close();
+
+  if (!file || rename(temporary.c_str(), path.c_str()) != 0) {
+    remove(temporary.c_str());
+    return false;
+  }
+
+  return true;
+}
+}
@@ -0,0 +1,97 @@
+/** Interface file for caching remapping maps on disk
+ *
+ *  \file ipcv/geometric_transformation/MapCache.h
+ *  \author Anthony Guarino (ag4933@rit.edu)
+ *  \date 16 Oct 2026
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <opencv2/core.hpp>
+
+namespace ipcv {
+
+/** Key of a pair of maps: the transform type, the version of the code
+ *  computing its maps, its parameters and the size of the maps
+ *
+ *  Files are named after a 64-bit FNV-1a hash of the key and hold the key
+ *  itself, so a hash collision never loads the maps of another key.
+ */
+class MapCacheKey {
+ public:
+  /** Start a key for a transform
+   *
+   *  \param[in] transform  name of the transform type
+   *  \param[in] version    version of the maps the transform computes,
+   *                        changed whenever they change
+   */
+  MapCacheKey(const std::string& transform, const int version);
+
+  /** Add a parameter to the key */
+  MapCacheKey& Add(const double value);
+  MapCacheKey& Add(const int value);
+  MapCacheKey& Add(const cv::Size& size);
+  MapCacheKey& Add(const std::vector<cv::Point>& points);
+
+  /** Hash of the transform type and the parameters added */
+  uint64_t Value() const { return hash_; }
+
+  /** Serialized transform type, version and parameters */
+  const std::string& Bytes() const { return bytes_; }
+
+ private:
+  void AddBytes(const void* data, const std::size_t size);
+
+  uint64_t hash_;
+  std::string bytes_;
+};
+
+/** Directory of cached maps, one compact binary file per key
+ *
+ *  A file holds a small header (hash, size and types) and the key,
+ *  followed by the rows of map1 and of map2.  Loaded maps are cv::Mat
+ *  over a private memory mapping of the file, so loading copies nothing;
+ *  the mapping belongs to the maps and is released with the last cv::Mat
+ *  referring to it.  Writing to loaded maps never changes the file.
+ */
+class MapCache {
+ public:
+  /** Use a directory of cached maps
+   *
+   *  \param[in] directory  existing directory holding the map files
+   */
+  explicit MapCache(const std::string& directory);
+
+  /** Load the maps of a key
+   *
+   *  \param[in] key    key of the maps
+   *  \param[out] map1  cv::Mat of the horizontal (x) coordinates
+   *  \param[out] map2  cv::Mat of the vertical (y) coordinates
+   *
+   *  \return false when the maps of the key are not cached
+   */
+  bool Load(const MapCacheKey& key, cv::Mat& map1, cv::Mat& map2);
+
+  /** Store the maps of a key, replacing any cached before
+   *
+   *  The file is written under a temporary name and renamed, so concurrent
+   *  runs never load a partly written file.
+   *
+   *  \param[in] key   key of the maps
+   *  \param[in] map1  cv::Mat of the horizontal (x) coordinates
+   *  \param[in] map2  cv::Mat of the vertical (y) coordinates (size of map1)
+   */
+  bool Store(const MapCacheKey& key, const cv::Mat& map1, const cv::Mat& map2);
+
+  /** Path of the file holding the maps of a key */
+  std::string Path(const MapCacheKey& key) const;
+
+ private:
+  std::string directory_;
+};
+}
@@ -8,7 +8,10 @@
 
 #include "MapGCP.h"
 
+#include <algorithm>
+#include <cmath>
 #include <iostream>
+#include <vector>
 
 #include <Eigen/Dense>
 #include <opencv2/core.hpp>
@@ -17,6 +20,238 @@ using namespace std;
 
 namespace ipcv {
 
+// Version of the maps MapGCP computes, changed whenever they change so
+// that maps cached by an older version are not loaded
+static const int kMapGCPVersion = 1;
+
+// Map columns between exact restarts of the forward differences, bounding
+// the rounding error their additions accumulate
+static const int kRestartColumns = 256;
+
+/** Fit the mapping polynomials to the ground control points
+ *
+ *  \param[in] src_points  ground control points from the source image
+ *  \param[in] map_points  ground control points from the map image
+ *  \param[in] order       mapping polynomial order
+ *  \param[out] a          coefficients of the horizontal (x) polynomial
+ *  \param[out] b          coefficients of the vertical (y) polynomial
+ */
+void FitGCP(const vector<cv::Point>& src_points,
+            const vector<cv::Point>& map_points, const int order,
+            Eigen::VectorXd& a, Eigen::VectorXd& b) {
+  // Construct X_Mat from the source points (target x and y coordinates)
+  Eigen::MatrixXd X_Mat(map_points.size(), (order + 1) * (order + 2) / 2);
+
+  for (size_t row_idx = 0; row_idx < map_points.size(); row_idx++) {
+    double P_x = map_points[row_idx].x;
+    double P_y = map_points[row_idx].y;
+    int idx = 0;
+
+    for (int i = 0; i <= order; i++) {
+      for (int j = 0; j <= i; j++) {
+        X_Mat(row_idx, idx) = std::pow(P_x, i - j) * std::pow(P_y, j);
+        idx++;
+      }
+    }
+  }
+
+  // Construct Y_Mat from the source points (target x and y coordinates)
+  Eigen::MatrixXd Y_Mat(src_points.size(), 2);
+  for (size_t row_idx = 0; row_idx < src_points.size(); row_idx++) {
+    Y_Mat(row_idx, 0) = src_points[row_idx].x;
+    Y_Mat(row_idx, 1) = src_points[row_idx].y;
+  }
+
+  // Solve for the coefficients using the least-squares solution
+  Eigen::MatrixXd AB =
+      (X_Mat.transpose() * X_Mat).ldlt().solve(X_Mat.transpose() * Y_Mat);
+  a = AB.col(0);  // Coefficients for x
+  b = AB.col(1);  // Coefficients for y
+}
+
+/** Coefficients of a fitted polynomial in the column along one map row
+ *
+ *  \param[in] coefficients  polynomial coefficients (in the term order of
+ *                           MapGCP)
+ *  \param[in] order         mapping polynomial order
+ *  \param[in] row           map row
+ *  \param[out] row_coefficients
+ *                           order + 1 coefficients, the k-th multiplying
+ *                           col^k
+ */
+static void RowPolynomial(const Eigen::VectorXd& coefficients, const int order,
+                          const double row, vector<double>& row_coefficients) {
+  row_coefficients.assign(order + 1, 0.0);
+  int idx = 0;
+  for (int i = 0; i <= order; i++) {
+    double row_power = 1;
+    for (int j = 0; j <= i; j++) {
+      row_coefficients[i - j] += coefficients(idx) * row_power;
+      row_power *= row;
+      idx++;
+    }
+  }
+}
+
+/** Value of a polynomial in the column (Horner's rule) */
+static double Horner(const vector<double>& row_coefficients, const double col) {
+  double value = 0;
+  for (int k = static_cast<int>(row_coefficients.size()) - 1; k >= 0; k--) {
+    value = value * col + row_coefficients[k];
+  }
+  return value;
+}
+
+/** Evaluate a polynomial along a map row with forward differences
+ *
+ *  A polynomial of order n has a constant n-th difference, so once the
+ *  differences at a column are known every next column takes n additions.
+ *
+ *  \param[in] row_coefficients  coefficients from RowPolynomial
+ *  \param[in] cols              map columns
+ *  \param[out] differences      scratch of order + 1 values
+ *  \param[out] dst              map row
+ */
+static void ForwardDifferenceRow(const vector<double>& row_coefficients,
+                                 const int cols, vector<double>& differences,
+                                 float* dst) {
+  const int order = static_cast<int>(row_coefficients.size()) - 1;
+  differences.resize(order + 1);
+
+  for (int start = 0; start < cols; start += kRestartColumns) {
+    // Differences at the start column from exact values
+    for (int k = 0; k <= order; k++) {
+      differences[k] = Horner(row_coefficients, start + k);
+    }
+    for (int k = 1; k <= order; k++) {
+      for (int m = order; m >= k; m--) {
+        differences[m] -= differences[m - 1];
+      }
+    }
+
+    const int end = std::min(cols, start + kRestartColumns);
+    for (int col = start; col < end; col++) {
+      dst[col] = static_cast<float>(differences[0]);
+      for (int k = 0; k < order; k++) {
+        differences[k] += differences[k + 1];
+      }
+    }
+  }
+}
+
+/** Positions of the exactly evaluated locations across a length: every
+ *  step pixels and the last pixel
+ */
+static vector<int> GridNodes(const int length, const int step) {
+  vector<int> nodes;
+  for (int position = 0; position < length - 1; position += step) {
+    nodes.push_back(position);
+  }
+  nodes.push_back(length - 1);
+  return nodes;
+}
+
+/** Build the maps by bilinear interpolation of a sparse grid of exactly
+ *  evaluated locations
+ *
+ *  \param[in] a       coefficients of the horizontal (x) polynomial
+ *  \param[in] b       coefficients of the vertical (y) polynomial
+ *  \param[in] order   mapping polynomial order
+ *  \param[in] step    pixels between exactly evaluated locations
+ *  \param[out] map1   horizontal map (allocated)
+ *  \param[out] map2   vertical map (allocated)
+ *
+ *  \return largest coordinate error at the center and edge midpoints of the
+ *          grid cells [pixels]
+ */
+static double InterpolateGrid(const Eigen::VectorXd& a, const Eigen::VectorXd& b,
+                              const int order, const int step, cv::Mat& map1,
+                              cv::Mat& map2) {
+  const vector<int> row_nodes = GridNodes(map1.rows, step);
+  const vector<int> col_nodes = GridNodes(map1.cols, step);
+  const size_t node_cols = col_nodes.size();
+
+  // Exact locations at the nodes
+  vector<double> node_x(row_nodes.size() * node_cols);
+  vector<double> node_y(row_nodes.size() * node_cols);
+  vector<double> row_a, row_b;
+  for (size_t r = 0; r < row_nodes.size(); r++) {
+    RowPolynomial(a, order, row_nodes[r], row_a);
+    RowPolynomial(b, order, row_nodes[r], row_b);
+    for (size_t c = 0; c < node_cols; c++) {
+      node_x[r * node_cols + c] = Horner(row_a, col_nodes[c]);
+      node_y[r * node_cols + c] = Horner(row_b, col_nodes[c]);
+    }
+  }
+
+  // Interpolate the node rows to every map row, then along the row
+  vector<double> row_x(node_cols), row_y(node_cols);
+  size_t cell = 0;
+  for (int row = 0; row < map1.rows; row++) {
+    while (cell + 2 < row_nodes.size() && row >= row_nodes[cell + 1]) {
+      cell++;
+    }
+    const size_t below = std::min(cell + 1, row_nodes.size() - 1);
+    const int height = row_nodes[below] - row_nodes[cell];
+    const double t =
+        (height > 0) ? static_cast<double>(row - row_nodes[cell]) / height : 0;
+    for (size_t c = 0; c < node_cols; c++) {
+      const double* top_x = &node_x[cell * node_cols];
+      const double* top_y = &node_y[cell * node_cols];
+      const double* bottom_x = &node_x[below * node_cols];
+      const double* bottom_y = &node_y[below * node_cols];
+      row_x[c] = top_x[c] + t * (bottom_x[c] - top_x[c]);
+      row_y[c] = top_y[c] + t * (bottom_y[c] - top_y[c]);
+    }
+
+    float* map1_row = map1.ptr<float>(row);
+    float* map2_row = map2.ptr<float>(row);
+    for (size_t c = 0; c + 1 < node_cols; c++) {
+      const int width = col_nodes[c + 1] - col_nodes[c];
+      const double step_x = (row_x[c + 1] - row_x[c]) / width;
+      const double step_y = (row_y[c + 1] - row_y[c]) / width;
+      double x = row_x[c];
+      double y = row_y[c];
+      for (int col = col_nodes[c]; col < col_nodes[c + 1]; col++) {
+        map1_row[col] = static_cast<float>(x);
+        map2_row[col] = static_cast<float>(y);
+        x += step_x;
+        y += step_y;
+      }
+    }
+    map1_row[map1.cols - 1] = static_cast<float>(row_x[node_cols - 1]);
+    map2_row[map1.cols - 1] = static_cast<float>(row_y[node_cols - 1]);
+  }
+
+  // Check the interpolated locations where bilinear interpolation strays
+  // furthest, halfway between the nodes
+  double error = 0;
+  auto check = [&](const int col, const int row) {
+    RowPolynomial(a, order, row, row_a);
+    RowPolynomial(b, order, row, row_b);
+    const double dx = Horner(row_a, col) - map1.at<float>(row, col);
+    const double dy = Horner(row_b, col) - map2.at<float>(row, col);
+    error = std::max(error, std::sqrt(dx * dx + dy * dy));
+  };
+  for (size_t r = 0; r + 1 < row_nodes.size(); r++) {
+    const int top = row_nodes[r];
+    const int bottom = row_nodes[r + 1];
+    const int middle_row = (top + bottom) / 2;
+    for (size_t c = 0; c + 1 < node_cols; c++) {
+      const int left = col_nodes[c];
+      const int right = col_nodes[c + 1];
+      const int middle_col = (left + right) / 2;
+      check(middle_col, middle_row);
+      check(middle_col, top);
+      check(middle_col, bottom);
+      check(left, middle_row);
+      check(right, middle_row);
+    }
+  }
+
+  return error;
+}
+
 /** Find the source coordinates (map1, map2) for a ground control point
  *  derived mapping polynomial transformation
  *
@@ -53,61 +288,103 @@ bool MapGCP(const cv::Mat src, const cv::Mat map,
             const vector<cv::Point> src_points,
             const vector<cv::Point> map_points, const int order, cv::Mat& map1,
             cv::Mat& map2) {
-    // Construct X_Mat from the source points (target x and y coordinates)
-  Eigen::MatrixXd X_Mat(map_points.size(), (order + 1) * (order + 2) / 2);
-
-  for (size_t row_idx = 0; row_idx < map_points.size(); row_idx++) {
-    double P_x = map_points[row_idx].x;
-    double P_y = map_points[row_idx].y;
-    int idx = 0;
+  GCPGrid grid;
+  return MapGCP(src, map, src_points, map_points, order, map1, map2, grid);
+}
 
-    for (int i = 0; i <= order; i++) {
-      for (int j = 0; j <= i; j++) {
-        X_Mat(row_idx, idx) = std::pow(P_x, i - j) * std::pow(P_y, j);
-        idx++;
-      }
-    }
+/** Find the source coordinates (map1, map2) for a ground control point
+ *  derived mapping polynomial transformation, evaluating the polynomial
+ *  exactly on a sparse grid only
+ *
+ *  \param[in] src   source cv::Mat of CV_8UC3
+ *  \param[in] map   map (target) cv::Mat of CV_8UC3
+ *  \param[in] src_points
+ *                   vector of cv::Points representing the ground control
+ *                   points from the source image
+ *  \param[in] map_points
+ *                   vector of cv::Points representing the ground control
+ *                   points from the map image
+ *  \param[in] order  mapping polynomial order
+ *                      EXAMPLES:
+ *                        order = 1
+ *                          a0*x^0*y^0 + a1*x^1*y^0 +
+ *                          a2*x^0*y^1
+ *                        order = 2
+ *                          a0*x^0*y^0 + a1*x^1*y^0 + a2*x^2*y^0 +
+ *                          a3*x^0*y^1 + a4*x^1*y^1 +
+ *                          a5*x^0*y^2
+ *                        order = 3
+ *                          a0*x^0*y^0 + a1*x^1*y^0 + a2*x^2*y^0 + a3*x^3*y^0 +
+ *                          a4*x^0*y^1 + a5*x^1*y^1 + a6*x^2*y^1 +
+ *                          a7*x^0*y^2 + a8*x^1*y^2 +
+ *                          a9*x^0*y^3
+ *  \param[out] map1  cv::Mat of CV_32FC1 (size of the destination map)
+ *                    containing the horizontal (x) coordinates at which to
+ *                    resample the source data
+ *  \param[out] map2  cv::Mat of CV_32FC1 (size of the destination map)
+ *                    containing the vertical (y) coordinates at which to
+ *                    resample the source data
+ *  \param[in,out] grid  grid step and error allowed; receives the step used
+ *                       and the error found
+ */
+bool MapGCP(const cv::Mat src, const cv::Mat map,
+            const vector<cv::Point> src_points,
+            const vector<cv::Point> map_points, const int order, cv::Mat& map1,
+            cv::Mat& map2, GCPGrid& grid) {
+  if (order < 0 || src_points.size() != map_points.size() || map.empty()) {
+    return false;
   }
 
-  // Construct Y_Mat from the source points (target x and y coordinates)
-  Eigen::MatrixXd Y_Mat(src_points.size(), 2);
-  for (size_t row_idx = 0; row_idx < src_points.size(); row_idx++) {
-    Y_Mat(row_idx, 0) = src_points[row_idx].x;
-    Y_Mat(row_idx, 1) = src_points[row_idx].y;
-  }
+  Eigen::VectorXd a;
+  Eigen::VectorXd b;
+  FitGCP(src_points, map_points, order, a, b);
 
-  // Solve for the coefficients using the least-squares solution
-  Eigen::MatrixXd AB =
-      (X_Mat.transpose() * X_Mat).ldlt().solve(X_Mat.transpose() * Y_Mat);
-  Eigen::VectorXd a = AB.col(0);  // Coefficients for x
-  Eigen::VectorXd b = AB.col(1);  // Coefficients for y
+  map1.create(map.size(), CV_32FC1);  // x-coordinate map
+  map2.create(map.size(), CV_32FC1);  // y-coordinate map
 
-  map1 = cv::Mat::zeros(map.size(), CV_32FC1);  // x-coordinate map
-  map2 = cv::Mat::zeros(map.size(), CV_32FC1);  // y-coordinate map
+  // Halve the grid step until the interpolated maps are accurate enough
+  for (int step = grid.step; step > 1; step /= 2) {
+    const double error = InterpolateGrid(a, b, order, step, map1, map2);
+    if (error <= grid.max_error) {
+      grid.used_step = step;
+      grid.error = error;
+      return true;
+    }
+  }
 
-  // Compute the mapped source coordinates for each pixel in the destination map
+  // Compute the mapped source coordinates for each pixel in the destination
+  // map, with additions only along each row
+  vector<double> row_a, row_b, differences;
   for (int row = 0; row < map.rows; row++) {
-    for (int col = 0; col < map.cols; col++) {
-      double x = 0.0;
-      double y = 0.0;
-      int idx = 0;
-
-      // Evaluate the polynomial for the current destination pixel (col, row)
-      for (int i = 0; i <= order; i++) {
-        for (int j = 0; j <= i; j++) {
-          double term = std::pow(col, i - j) * std::pow(row, j);
-          x += a(idx) * term;
-          y += b(idx) * term;
-          idx++;
-        }
-      }
-
-      // Assign the computed x and y coordinates to the map
-      map1.at<float>(row, col) = static_cast<float>(x);
-      map2.at<float>(row, col) = static_cast<float>(y);
-    }
+    RowPolynomial(a, order, row, row_a);
+    RowPolynomial(b, order, row, row_b);
+    ForwardDifferenceRow(row_a, map.cols, differences, map1.ptr<float>(row));
+    ForwardDifferenceRow(row_b, map.cols, differences, map2.ptr<float>(row));
   }
 
+  grid.used_step = 1;
+  grid.error = 0;
   return true;
 }
+
+/** Key of the maps MapGCP finds, for a MapCache
+ *
+ *  \param[in] map_size    size of the map (target)
+ *  \param[in] src_points  ground control points from the source image
+ *  \param[in] map_points  ground control points from the map image
+ *  \param[in] order       mapping polynomial order
+ *  \param[in] grid        grid step and error allowed
+ */
+MapCacheKey MapGCPCacheKey(const cv::Size& map_size,
+                           const vector<cv::Point>& src_points,
+                           const vector<cv::Point>& map_points,
+                           const int order, const GCPGrid& grid) {
+  return MapCacheKey("MapGCP", kMapGCPVersion)
+      .Add(map_size)
+      .Add(src_points)
+      .Add(map_points)
+      .Add(order)
+      .Add(grid.step)
+      .Add(grid.max_error);
+}
 }
@@ -10,12 +10,50 @@
 
 #include <iostream>
 
+#include <Eigen/Dense>
 #include <opencv2/core.hpp>
 
+#include "MapCache.h"
+
 using namespace std;
 
 namespace ipcv {
 
+/** Sparse-grid evaluation of the mapping polynomial
+ *
+ *  \var step       pixels between exactly evaluated map locations; the
+ *                  locations in between are interpolated bilinearly (1
+ *                  evaluates every location)
+ *  \var max_error  largest coordinate error allowed [pixels]; the error is
+ *                  checked at the center and edge midpoints of every grid
+ *                  cell and the step halved until it is met
+ *  \var used_step  step the maps were built with (output)
+ *  \var error      largest coordinate error found at the checked locations
+ *                  [pixels] (output)
+ */
+struct GCPGrid {
+  int step = 1;
+  double max_error = 0.1;
+  int used_step = 1;
+  double error = 0;
+};
+
+/** Fit the mapping polynomials to the ground control points by least
+ *  squares
+ *
+ *  Term k of a polynomial, in the order of MapGCP, multiplies
+ *  x^(i - j) * y^j for the k-th (i, j) with i = 0..order and j = 0..i.
+ *
+ *  \param[in] src_points  ground control points from the source image
+ *  \param[in] map_points  ground control points from the map image
+ *  \param[in] order       mapping polynomial order
+ *  \param[out] a          coefficients of the horizontal (x) polynomial
+ *  \param[out] b          coefficients of the vertical (y) polynomial
+ */
+void FitGCP(const vector<cv::Point>& src_points,
+            const vector<cv::Point>& map_points, const int order,
+            Eigen::VectorXd& a, Eigen::VectorXd& b);
+
 /** Find the source coordinates (map1, map2) for a ground control point
  *  derived mapping polynomial transformation
  *
@@ -52,4 +90,44 @@ bool MapGCP(const cv::Mat src, const cv::Mat map,
             const vector<cv::Point> src_points,
             const vector<cv::Point> map_points, const int order, cv::Mat& map1,
             cv::Mat& map2);
+
+/** Find the source coordinates (map1, map2) for a ground control point
+ *  derived mapping polynomial transformation, evaluating the polynomial
+ *  exactly on a sparse grid only
+ *
+ *  \param[in] src   source cv::Mat of CV_8UC3
+ *  \param[in] map   map (target) cv::Mat of CV_8UC3
+ *  \param[in] src_points
+ *                   vector of cv::Points representing the ground control
+ *                   points from the source image
+ *  \param[in] map_points
+ *                   vector of cv::Points representing the ground control
+ *                   points from the map image
+ *  \param[in] order  mapping polynomial order
+ *  \param[out] map1  cv::Mat of CV_32FC1 (size of the destination map)
+ *                    containing the horizontal (x) coordinates at which to
+ *                    resample the source data
+ *  \param[out] map2  cv::Mat of CV_32FC1 (size of the destination map)
+ *                    containing the vertical (y) coordinates at which to
+ *                    resample the source data
+ *  \param[in,out] grid  grid step and error allowed; receives the step used
+ *                       and the error found
+ */
+bool MapGCP(const cv::Mat src, const cv::Mat map,
+            const vector<cv::Point> src_points,
+            const vector<cv::Point> map_points, const int order, cv::Mat& map1,
+            cv::Mat& map2, GCPGrid& grid);
+
+/** Key of the maps MapGCP finds, for a MapCache
+ *
+ *  \param[in] map_size    size of the map (target)
+ *  \param[in] src_points  ground control points from the source image
+ *  \param[in] map_points  ground control points from the map image
+ *  \param[in] order       mapping polynomial order
+ *  \param[in] grid        grid step and error allowed
+ */
+MapCacheKey MapGCPCacheKey(const cv::Size& map_size,
+                           const vector<cv::Point>& src_points,
+                           const vector<cv::Point>& map_points,
+                           const int order, const GCPGrid& grid);
 }
\ No newline at end of file
@@ -16,6 +16,9 @@ using namespace std;
 
 namespace ipcv {
 
+// Version of the maps MapPolar computes (for MapPolarCacheKey)
+static const int kMapPolarVersion = 1;
+
 /** Find the source coordinates (map1, map2) for a polar or log-polar transformation
  *
  *  \param[in] src       source cv::Mat of CV_8UC3
@@ -85,4 +88,14 @@ bool MapPolar(const cv::Mat src, const bool use_log, cv::Mat& map1,
   return true;
 }
 
+/** Key of the maps MapPolar finds, for a MapCache
+ *
+ *  \param[in] src_size  size of the source
+ *  \param[in] use_log   log-polar rather than polar mapping
+ */
+MapCacheKey MapPolarCacheKey(const cv::Size& src_size, const bool use_log) {
+  return MapCacheKey("MapPolar", kMapPolarVersion)
+      .Add(src_size)
+      .Add(use_log ? 1 : 0);
+}
 }
@@ -11,8 +11,17 @@
 
 #include <Eigen/Dense>
 
+#include "MapCache.h"
+
 namespace ipcv {
 
 bool MapPolar(const cv::Mat src, const bool use_log, cv::Mat& map1,
               cv::Mat& map2);
+
+/** Key of the maps MapPolar finds, for a MapCache
+ *
+ *  \param[in] src_size  size of the source
+ *  \param[in] use_log   log-polar rather than polar mapping
+ */
+MapCacheKey MapPolarCacheKey(const cv::Size& src_size, const bool use_log);
 }
\ No newline at end of file
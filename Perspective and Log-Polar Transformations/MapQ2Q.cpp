@@ -15,38 +15,27 @@ using namespace std;
 
 namespace ipcv {
 
-/** Find the source coordinates (map1, map2) for a quad to quad mapping
+// Version of the maps MapQ2Q computes (for MapQ2QCacheKey)
+static const int kMapQ2QVersion = 1;
+
+/** Find the perspective transformation taking target pixels to the source
+ *  for a quad to quad mapping
  *
- *  \param[in] src       source cv::Mat of CV_8UC3
- *  \param[in] tgt       target cv::Mat of CV_8UC3
  *  \param[in] src_vertices
  *                       vertices cv::Point of the source quadrilateral (CW)
- *                       which is to be mapped to the target quadrilateral
  *  \param[in] tgt_vertices
  *                       vertices cv::Point of the target quadrilateral (CW)
- *                       into which the source quadrilateral is to be mapped
- *  \param[out] map1     cv::Mat of CV_32FC1 (size of the destination map)
- *                       containing the horizontal (x) coordinates at
- *                       which to resample the source data
- *  \param[out] map2     cv::Mat of CV_32FC1 (size of the destination map)
- *                       containing the vertical (y) coordinates at
- *                       which to resample the source data
+ *  \param[out] P       target to source perspective transformation matrix
  */
-bool MapQ2Q(const cv::Mat src, const cv::Mat tgt,
-            const vector<cv::Point> src_vertices,
-            const vector<cv::Point> tgt_vertices, cv::Mat& map1,
-            cv::Mat& map2) {
-
-  // Initialize map1 and map2
-  map1 = cv::Mat(tgt.size(), CV_32FC1);
-  map2 = cv::Mat(tgt.size(), CV_32FC1);
+bool Q2QHomography(const vector<cv::Point>& src_vertices,
+                   const vector<cv::Point>& tgt_vertices, Eigen::Matrix3d& P) {
+  if (src_vertices.size() != 4 || tgt_vertices.size() != 4) {
+    return false;
+  }
 
   // Define matrices
-  Eigen::MatrixXd map_mat(8, 8);
-  Eigen::MatrixXd src_point(8, 1);
-  Eigen::MatrixXd tgt_point(8, 1);
-  Eigen::MatrixXd src_final(3, 1);
-  Eigen::MatrixXd tgt_final(3, 1);
+  Eigen::Matrix<double, 8, 8> map_mat;
+  Eigen::Matrix<double, 8, 1> src_point;
 
   // Fill the transformation matrix
   for (int i = 0; i < 4; i++) {
@@ -70,35 +59,88 @@ bool MapQ2Q(const cv::Mat src, const cv::Mat tgt,
   }
 
   // Set up the source quad points matrix
-  src_point << src_vertices[0].x,
-  src_vertices[1].x, src_vertices[2].x, src_vertices[3].x, src_vertices[0].y,
-  src_vertices[1].y, src_vertices[2].y, src_vertices[3].y;
+  src_point << src_vertices[0].x, src_vertices[1].x, src_vertices[2].x,
+      src_vertices[3].x, src_vertices[0].y, src_vertices[1].y,
+      src_vertices[2].y, src_vertices[3].y;
 
   // Solve for the transformation coefficients
-  tgt_point = map_mat.inverse() * src_point;
+  const Eigen::FullPivLU<Eigen::Matrix<double, 8, 8>> lu(map_mat);
+  if (!lu.isInvertible()) {
+    return false;
+  }
+  const Eigen::Matrix<double, 8, 1> tgt_point = lu.solve(src_point);
 
   // Build the perspective transformation matrix
-  Eigen::MatrixXd P(3, 3);
-  
   P << tgt_point(0), tgt_point(1), tgt_point(2), tgt_point(3), tgt_point(4),
       tgt_point(5), tgt_point(6), tgt_point(7), 1;
 
-  // Loop through every pixel in the target image to find the corresponding source pixel
+  return true;
+}
+
+/** Find the source coordinates (map1, map2) for a quad to quad mapping
+ *
+ *  \param[in] src       source cv::Mat of CV_8UC3
+ *  \param[in] tgt       target cv::Mat of CV_8UC3
+ *  \param[in] src_vertices
+ *                       vertices cv::Point of the source quadrilateral (CW)
+ *                       which is to be mapped to the target quadrilateral
+ *  \param[in] tgt_vertices
+ *                       vertices cv::Point of the target quadrilateral (CW)
+ *                       into which the source quadrilateral is to be mapped
+ *  \param[out] map1     cv::Mat of CV_32FC1 (size of the destination map)
+ *                       containing the horizontal (x) coordinates at
+ *                       which to resample the source data
+ *  \param[out] map2     cv::Mat of CV_32FC1 (size of the destination map)
+ *                       containing the vertical (y) coordinates at
+ *                       which to resample the source data
+ */
+bool MapQ2Q(const cv::Mat src, const cv::Mat tgt,
+            const vector<cv::Point> src_vertices,
+            const vector<cv::Point> tgt_vertices, cv::Mat& map1,
+            cv::Mat& map2) {
+  Eigen::Matrix3d P;
+  if (!Q2QHomography(src_vertices, tgt_vertices, P)) {
+    return false;
+  }
+
+  // Initialize map1 and map2
+  map1 = cv::Mat(tgt.size(), CV_32FC1);
+  map2 = cv::Mat(tgt.size(), CV_32FC1);
+
+  // Loop through every pixel in the target image to find the corresponding
+  // source pixel
   for (int row_idx = 0; row_idx < tgt.rows; row_idx++) {
+    float* map1_row = map1.ptr<float>(row_idx);
+    float* map2_row = map2.ptr<float>(row_idx);
     for (int col_idx = 0; col_idx < tgt.cols; col_idx++) {
-      
-      // Create a point for the target pixel
-      tgt_final << col_idx, row_idx, 1;
-      
       // Transform the target point to the source using matrix P
-      src_final << P * tgt_final;
+      const double x = P(0, 0) * col_idx + P(0, 1) * row_idx + P(0, 2);
+      const double y = P(1, 0) * col_idx + P(1, 1) * row_idx + P(1, 2);
+      const double w = P(2, 0) * col_idx + P(2, 1) * row_idx + P(2, 2);
 
       // Fill in final map with the solved result
-      map1.at<float>(row_idx, col_idx) = static_cast<float>(src_final(0) / src_final(2));
-      map2.at<float>(row_idx, col_idx) = static_cast<float>(src_final(1) / src_final(2));
+      map1_row[col_idx] = static_cast<float>(x / w);
+      map2_row[col_idx] = static_cast<float>(y / w);
     }
   }
 
   return true;
 }
+
+/** Key of the maps MapQ2Q finds, for a MapCache
+ *
+ *  \param[in] tgt_size  size of the target
+ *  \param[in] src_vertices
+ *                       vertices cv:Point of the source quadrilateral (CW)
+ *  \param[in] tgt_vertices
+ *                       vertices cv:Point of the target quadrilateral (CW)
+ */
+MapCacheKey MapQ2QCacheKey(const cv::Size& tgt_size,
+                           const vector<cv::Point>& src_vertices,
+                           const vector<cv::Point>& tgt_vertices) {
+  return MapCacheKey("MapQ2Q", kMapQ2QVersion)
+      .Add(tgt_size)
+      .Add(src_vertices)
+      .Add(tgt_vertices);
+}
 }
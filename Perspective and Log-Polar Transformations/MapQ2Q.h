@@ -12,10 +12,29 @@
 #include <Eigen/Dense>
 #include <opencv2/core.hpp>
 
+#include "MapCache.h"
+
 using namespace std;
 
 namespace ipcv {
 
+/** Find the perspective transformation taking target pixels to the source
+ *  for a quad to quad mapping
+ *
+ *  Target pixel (row, col) resamples the source at
+ *  (P(0, .) . (col, row, 1), P(1, .) . (col, row, 1)) / P(2, .) . (col, row, 1).
+ *
+ *  \param[in] src_vertices
+ *                       vertices cv:Point of the source quadrilateral (CW)
+ *  \param[in] tgt_vertices
+ *                       vertices cv:Point of the target quadrilateral (CW)
+ *  \param[out] P       target to source perspective transformation matrix
+ *
+ *  \return false when the quadrilaterals are degenerate
+ */
+bool Q2QHomography(const vector<cv::Point>& src_vertices,
+                   const vector<cv::Point>& tgt_vertices, Eigen::Matrix3d& P);
+
 /** Find the source coordinates (map1, map2) for a quad to quad mapping
  *
  *  \param[in] src       source cv::Mat of CV_8UC3
@@ -36,4 +55,16 @@ namespace ipcv {
 bool MapQ2Q(const cv::Mat src, const cv::Mat tgt,
             const vector<cv::Point> src_vertices,
             const vector<cv::Point> tgt_vertices, cv::Mat& map1, cv::Mat& map2);
+
+/** Key of the maps MapQ2Q finds, for a MapCache
+ *
+ *  \param[in] tgt_size  size of the target
+ *  \param[in] src_vertices
+ *                       vertices cv:Point of the source quadrilateral (CW)
+ *  \param[in] tgt_vertices
+ *                       vertices cv:Point of the target quadrilateral (CW)
+ */
+MapCacheKey MapQ2QCacheKey(const cv::Size& tgt_size,
+                           const vector<cv::Point>& src_vertices,
+                           const vector<cv::Point>& tgt_vertices);
 }
@@ -15,29 +15,28 @@ using namespace std;
 
 namespace ipcv {
 
-/** Find the map coordinates (map1, map2) for an RST transformation
+// Version of the maps MapRST computes (for MapRSTCacheKey)
+static const int kMapRSTVersion = 1;
+
+/** Find the affine matrix and the destination size of an RST transformation
  *
- *  \param[in] src           source cv::Mat of CV_8UC3
+ *  \param[in] src_size      size of the source
  *  \param[in] angle         rotation angle (CCW) [radians]
  *  \param[in] scale_x       horizontal scale
  *  \param[in] scale_y       vertical scale
  *  \param[in] translation_x horizontal translation [+ right]
  *  \param[in] translation_y vertical translation [+ up]
- *  \param[out] map1         cv::Mat of CV_32FC1 (size of the destination map)
- *                           containing the horizontal (x) coordinates at
- *                           which to resample the source data
- *  \param[out] map2         cv::Mat of CV_32FC1 (size of the destination map)
- *                           containing the vertical (y) coordinates at
- *                           which to resample the source data
+ *  \param[out] affine       destination to source affine matrix
+ *  \param[out] dst_size     size of the destination
  */
-bool MapRST(const cv::Mat src, const double angle, const double scale_x,
-            const double scale_y, const double translation_x,
-            const double translation_y, cv::Mat& map1, cv::Mat& map2) {
+void RSTAffine(const cv::Size& src_size, const double angle,
+               const double scale_x, const double scale_y,
+               const double translation_x, const double translation_y,
+               Eigen::Matrix3d& affine, cv::Size& dst_size) {
   // Create Matricies
   Eigen::Matrix3d rotation;
   Eigen::Matrix3d scale;
   Eigen::Matrix3d translation;
-  Eigen::Matrix3d affine;
 
   // Stream in values for matricies
   rotation << cos(angle), -sin(angle), 0, sin(angle), cos(angle), 0, 0, 0, 1;
@@ -47,13 +46,13 @@ bool MapRST(const cv::Mat src, const double angle, const double scale_x,
 
   // Calculate corners
   Eigen::Vector3d TopLeft;
-  TopLeft << -src.cols / 2, src.rows / 2, 1;
+  TopLeft << -src_size.width / 2, src_size.height / 2, 1;
   Eigen::Vector3d BottomLeft;
-  BottomLeft << -src.cols / 2, -src.rows / 2, 1;
+  BottomLeft << -src_size.width / 2, -src_size.height / 2, 1;
   Eigen::Vector3d TopRight;
-  TopRight << src.cols / 2, src.rows / 2, 1;
+  TopRight << src_size.width / 2, src_size.height / 2, 1;
   Eigen::Vector3d BottomRight;
-  BottomRight << src.cols / 2, -src.rows / 2, 1;
+  BottomRight << src_size.width / 2, -src_size.height / 2, 1;
 
   // Calculate new transformed corners
   Eigen::Vector3d NTopLeft = affine.inverse() * TopLeft;
@@ -62,29 +61,98 @@ bool MapRST(const cv::Mat src, const double angle, const double scale_x,
   Eigen::Vector3d NBottomRight = affine.inverse() * BottomRight;
 
   // Find size of rows and columns
-  int rows = static_cast<int>(std::ceil(std::max(
+  dst_size.height = static_cast<int>(std::ceil(std::max(
       abs(NTopLeft(1) - NBottomRight(1)), abs(NTopRight(1) - NBottomLeft(1)))));
-  int cols = static_cast<int>(std::ceil(std::max(
+  dst_size.width = static_cast<int>(std::ceil(std::max(
       abs(NTopLeft(0) - NBottomRight(0)), abs(NTopRight(0) - NBottomLeft(0)))));
+}
+
+/** Find the source location of the first pixel of a destination row of an
+ *  RST transformation
+ *
+ *  \param[in] affine    destination to source affine matrix from RSTAffine
+ *  \param[in] src_size  size of the source
+ *  \param[in] dst_size  size of the destination from RSTAffine
+ *  \param[in] row       destination row
+ *  \param[out] x        horizontal source coordinate
+ *  \param[out] y        vertical source coordinate
+ */
+void RSTRowStart(const Eigen::Matrix3d& affine, const cv::Size& src_size,
+                 const cv::Size& dst_size, const int row, double& x,
+                 double& y) {
+  const double col_offset = -(dst_size.width / 2);
+  const double row_offset = row - dst_size.height / 2;
+  x = affine(0, 0) * col_offset + affine(0, 1) * row_offset + affine(0, 2) +
+      src_size.width / 2;
+  y = affine(1, 0) * col_offset + affine(1, 1) * row_offset + affine(1, 2) +
+      src_size.height / 2;
+}
+
+/** Find the map coordinates (map1, map2) for an RST transformation
+ *
+ *  \param[in] src           source cv::Mat of CV_8UC3
+ *  \param[in] angle         rotation angle (CCW) [radians]
+ *  \param[in] scale_x       horizontal scale
+ *  \param[in] scale_y       vertical scale
+ *  \param[in] translation_x horizontal translation [+ right]
+ *  \param[in] translation_y vertical translation [+ up]
+ *  \param[out] map1         cv::Mat of CV_32FC1 (size of the destination map)
+ *                           containing the horizontal (x) coordinates at
+ *                           which to resample the source data
+ *  \param[out] map2         cv::Mat of CV_32FC1 (size of the destination map)
+ *                           containing the vertical (y) coordinates at
+ *                           which to resample the source data
+ */
+bool MapRST(const cv::Mat src, const double angle, const double scale_x,
+            const double scale_y, const double translation_x,
+            const double translation_y, cv::Mat& map1, cv::Mat& map2) {
+  Eigen::Matrix3d affine;
+  cv::Size size;
+  RSTAffine(src.size(), angle, scale_x, scale_y, translation_x, translation_y,
+            affine, size);
 
   // Make maps the correct size based on size of transformed rows and columns
-  map1.create(rows, cols, CV_32FC1);
-  map2.create(rows, cols, CV_32FC1);
-
-  // Fill map1 and map2 with the values from the location at the source
-  for (int row_idx = 0; row_idx < rows; row_idx++) {
-    for (int col_idx = 0; col_idx < cols; col_idx++) {
-      Eigen::Vector3d dst_point;
-      dst_point << col_idx - cols / 2, row_idx - rows / 2, 1;
-      Eigen::Vector3d src_point = affine * dst_point;
-
-      map1.at<float>(row_idx, col_idx) =
-          static_cast<float>(src_point(0) + src.cols / 2);
-      map2.at<float>(row_idx, col_idx) =
-          static_cast<float>(src_point(1) + src.rows / 2);
+  map1.create(size, CV_32FC1);
+  map2.create(size, CV_32FC1);
+
+  // Fill map1 and map2 with the values from the location at the source,
+  // stepping along each row (WarpRST steps identically)
+  for (int row_idx = 0; row_idx < size.height; row_idx++) {
+    double x, y;
+    RSTRowStart(affine, src.size(), size, row_idx, x, y);
+
+    float* map1_row = map1.ptr<float>(row_idx);
+    float* map2_row = map2.ptr<float>(row_idx);
+    for (int col_idx = 0; col_idx < size.width; col_idx++) {
+      map1_row[col_idx] = static_cast<float>(x);
+      map2_row[col_idx] = static_cast<float>(y);
+      x += affine(0, 0);
+      y += affine(1, 0);
     }
   }
 
   return true;
 }
-}
\ No newline at end of file
+
+/** Key of the maps MapRST finds, for a MapCache
+ *
+ *  \param[in] src_size      size of the source
+ *  \param[in] angle         rotation angle (CCW) [radians]
+ *  \param[in] scale_x       horizontal scale
+ *  \param[in] scale_y       vertical scale
+ *  \param[in] translation_x horizontal translation [+ to the right]
+ *  \param[in] translation_y vertical translation [+ up]
+ */
+MapCacheKey MapRSTCacheKey(const cv::Size& src_size, const double angle,
+                           const double scale_x, const double scale_y,
+                           const double translation_x,
+                           const double translation_y) {
+  return MapCacheKey("MapRST", kMapRSTVersion)
+      .Add(src_size)
+      .Add(angle)
+      .Add(scale_x)
+      .Add(scale_y)
+      .Add(translation_x)
+      .Add(translation_y);
+}
+}
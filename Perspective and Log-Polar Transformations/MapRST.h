@@ -11,8 +11,45 @@
 
 #include <Eigen/Dense>
 
+#include "MapCache.h"
+
 namespace ipcv {
 
+/** Find the affine matrix and the destination size of an RST transformation
+ *
+ *  Destination pixel (row, col) resamples the source at
+ *  affine * (col - dst_size.width / 2, row - dst_size.height / 2, 1), offset
+ *  by (src_size.width / 2, src_size.height / 2) (integer divisions).
+ *
+ *  \param[in] src_size      size of the source
+ *  \param[in] angle         rotation angle (CCW) [radians]
+ *  \param[in] scale_x       horizontal scale
+ *  \param[in] scale_y       vertical scale
+ *  \param[in] translation_x horizontal translation [+ to the right]
+ *  \param[in] translation_y vertical translation [+ up]
+ *  \param[out] affine       destination to source affine matrix
+ *  \param[out] dst_size     size of the destination
+ */
+void RSTAffine(const cv::Size& src_size, const double angle,
+               const double scale_x, const double scale_y,
+               const double translation_x, const double translation_y,
+               Eigen::Matrix3d& affine, cv::Size& dst_size);
+
+/** Find the source location of the first pixel of a destination row of an
+ *  RST transformation; every column to the right adds
+ *  (affine(0, 0), affine(1, 0)) to it
+ *
+ *  \param[in] affine    destination to source affine matrix from RSTAffine
+ *  \param[in] src_size  size of the source
+ *  \param[in] dst_size  size of the destination from RSTAffine
+ *  \param[in] row       destination row
+ *  \param[out] x        horizontal source coordinate
+ *  \param[out] y        vertical source coordinate
+ */
+void RSTRowStart(const Eigen::Matrix3d& affine, const cv::Size& src_size,
+                 const cv::Size& dst_size, const int row, double& x,
+                 double& y);
+
 /** Find the map coordinates (map1, map2) for an RST transformation
  *
  *  \param[in] src           source cv::Mat of CV_8UC3
@@ -31,4 +68,18 @@ namespace ipcv {
 bool MapRST(const cv::Mat src, const double angle, const double scale_x,
             const double scale_y, const double translation_x,
             const double translation_y, cv::Mat& map1, cv::Mat& map2);
+
+/** Key of the maps MapRST finds, for a MapCache
+ *
+ *  \param[in] src_size      size of the source
+ *  \param[in] angle         rotation angle (CCW) [radians]
+ *  \param[in] scale_x       horizontal scale
+ *  \param[in] scale_y       vertical scale
+ *  \param[in] translation_x horizontal translation [+ to the right]
+ *  \param[in] translation_y vertical translation [+ up]
+ */
+MapCacheKey MapRSTCacheKey(const cv::Size& src_size, const double angle,
+                           const double scale_x, const double scale_y,
+                           const double translation_x,
+                           const double translation_y);
 }
@@ -6,18 +6,399 @@
  */
 
 #include "Remap.h"
+#include "RemapPixel.h"
 #include <opencv2/opencv.hpp>
+#include <algorithm>
+#include <cstdint>
 #include <iostream>
 #include <cmath>
+#include <vector>
+
+#include "imgs/ipcv/parallel/TileExecutor.h"
 
 using namespace std;
 
 namespace ipcv {
 
+// Fractional positions between source pixels at which the bicubic and
+// Lanczos weights are tabulated
+static const int kWeightTableSize = 1024;
+
+// Free parameter of the bicubic (Keys) kernel
+static const double kBicubicA = -0.5;
+
+/** Bicubic (Keys) kernel at a distance t */
+static double BicubicKernel(double t) {
+  t = std::abs(t);
+  if (t <= 1) {
+    return ((kBicubicA + 2) * t - (kBicubicA + 3)) * t * t + 1;
+  } else if (t < 2) {
+    return ((kBicubicA * t - 5 * kBicubicA) * t + 8 * kBicubicA) * t -
+           4 * kBicubicA;
+  }
+  return 0;
+}
+
+/** Lanczos (a = 3) kernel at a distance t */
+static double Lanczos3Kernel(const double t) {
+  if (t == 0) {
+    return 1;
+  } else if (std::abs(t) >= 3) {
+    return 0;
+  }
+  const double pi_t = M_PI * t;
+  return 3 * std::sin(pi_t) * std::sin(pi_t / 3) / (pi_t * pi_t);
+}
+
+/** Tabulate the weights of the taps pixels around every fractional
+ *  position
+ *
+ *  Row f of the table holds the weights, normalized to sum to 1, of the
+ *  pixels floor(x) - (taps / 2 - 1) to floor(x) + taps / 2 for a location
+ *  x with a fraction of f / kWeightTableSize.
+ *
+ *  \param[in] interpolation  BICUBIC or LANCZOS3
+ *  \param[in] taps           pixels the kernel covers along each axis
+ */
+static vector<float> WeightTable(const Interpolation interpolation,
+                                 const int taps) {
+  vector<float> table((kWeightTableSize + 1) * taps);
+  for (int f = 0; f <= kWeightTableSize; f++) {
+    const double fraction = static_cast<double>(f) / kWeightTableSize;
+    vector<double> weights(taps);
+    double sum = 0;
+    for (int k = 0; k < taps; k++) {
+      const double t = k - (taps / 2 - 1) - fraction;
+      weights[k] = (interpolation == Interpolation::BICUBIC)
+                       ? BicubicKernel(t)
+                       : Lanczos3Kernel(t);
+      sum += weights[k];
+    }
+    for (int k = 0; k < taps; k++) {
+      table[f * taps + k] = static_cast<float>(weights[k] / sum);
+    }
+  }
+  return table;
+}
+
+/** Remap the destination rows with one inner loop per source type,
+ *  interpolation and border mode (no per-pixel switches), resampling each
+ *  pixel with RemapPixelNearest or RemapPixelLinear
+ *
+ *  \param[in] src     source cv::Mat of Cn channels of T
+ *  \param[out] dst    destination cv::Mat (allocated, size of the maps)
+ *  \param[in] map1    horizontal (x) source coordinates
+ *  \param[in] map2    vertical (y) source coordinates
+ *  \param[in] border  border value of every channel
+ */
+template <typename T, int Cn, Interpolation I, BorderMode B>
+static void RemapLoop(const cv::Mat& src, cv::Mat& dst, const cv::Mat& map1,
+                      const cv::Mat& map2, const T border) {
+  for (int row_idx = 0; row_idx < dst.rows; row_idx++) {
+    const float* map1_row = map1.ptr<float>(row_idx);
+    const float* map2_row = map2.ptr<float>(row_idx);
+    T* dst_pixel = dst.ptr<T>(row_idx);
+
+    for (int col_idx = 0; col_idx < dst.cols; col_idx++, dst_pixel += Cn) {
+      if (I == Interpolation::NEAREST) {
+        RemapPixelNearest<T, Cn, B>(src, map1_row[col_idx], map2_row[col_idx],
+                                    border, dst_pixel);
+      } else {
+        RemapPixelLinear<T, Cn, B>(src, map1_row[col_idx], map2_row[col_idx],
+                                   border, dst_pixel);
+      }
+    }
+  }
+}
+
+/** Remap the destination rows with a separable kernel of Taps x Taps
+ *  source pixels whose weights come from a table
+ *
+ *  Tap coordinates are clamped into the image with min/max rather than
+ *  branches, which keeps the inner loops free of data-dependent control
+ *  flow.
+ *
+ *  \param[in] src      source cv::Mat of Cn channels of T
+ *  \param[out] dst     destination cv::Mat (allocated, size of the maps)
+ *  \param[in] map1     horizontal (x) source coordinates
+ *  \param[in] map2     vertical (y) source coordinates
+ *  \param[in] border   border value of every channel
+ *  \param[in] weights  weight table from WeightTable
+ */
+template <typename T, int Cn, int Taps, BorderMode B>
+static void RemapKernelLoop(const cv::Mat& src, cv::Mat& dst,
+                            const cv::Mat& map1, const cv::Mat& map2,
+                            const T border, const float* weights) {
+  const int last_col = src.cols - 1;
+  const int last_row = src.rows - 1;
+
+  for (int row_idx = 0; row_idx < dst.rows; row_idx++) {
+    const float* map1_row = map1.ptr<float>(row_idx);
+    const float* map2_row = map2.ptr<float>(row_idx);
+    T* dst_pixel = dst.ptr<T>(row_idx);
+
+    for (int col_idx = 0; col_idx < dst.cols; col_idx++, dst_pixel += Cn) {
+      double x = map1_row[col_idx];
+      double y = map2_row[col_idx];
+
+      if (B == BorderMode::CONSTANT) {
+        if (x < 0 || x >= last_col || y < 0 || y >= last_row) {
+          for (int c = 0; c < Cn; c++) {
+            dst_pixel[c] = border;
+          }
+          continue;
+        }
+      } else {
+        x = std::min(std::max(x, 0.0), static_cast<double>(last_col));
+        y = std::min(std::max(y, 0.0), static_cast<double>(last_row));
+      }
+
+      const int x1 = (int)floor(x);
+      const int y1 = (int)floor(y);
+      const float* weights_x =
+          weights +
+          (int)(static_cast<float>(x - x1) * kWeightTableSize + 0.5f) * Taps;
+      const float* weights_y =
+          weights +
+          (int)(static_cast<float>(y - y1) * kWeightTableSize + 0.5f) * Taps;
+
+      // Source columns and rows of the taps, repeating the edge pixels
+      const int first_tap = -(Taps / 2 - 1);
+      int tap_cols[Taps];
+      int tap_rows[Taps];
+      for (int k = 0; k < Taps; k++) {
+        tap_cols[k] = std::min(std::max(x1 + first_tap + k, 0), last_col) * Cn;
+        tap_rows[k] = std::min(std::max(y1 + first_tap + k, 0), last_row);
+      }
+
+      float sum[Cn] = {};
+      for (int ky = 0; ky < Taps; ky++) {
+        const T* src_row = src.ptr<T>(tap_rows[ky]);
+        float row_sum[Cn] = {};
+        for (int kx = 0; kx < Taps; kx++) {
+          const T* src_pixel = src_row + tap_cols[kx];
+          for (int c = 0; c < Cn; c++) {
+            row_sum[c] += weights_x[kx] * src_pixel[c];
+          }
+        }
+        for (int c = 0; c < Cn; c++) {
+          sum[c] += weights_y[ky] * row_sum[c];
+        }
+      }
+
+      for (int c = 0; c < Cn; c++) {
+        dst_pixel[c] = cv::saturate_cast<T>(sum[c]);
+      }
+    }
+  }
+}
+
+/** Remap a source of Cn channels of T, choosing the loop for the
+ *  interpolation and border mode
+ */
+template <typename T, int Cn>
+static void RemapChannels(const cv::Mat& src, cv::Mat& dst,
+                          const cv::Mat& map1, const cv::Mat& map2,
+                          const Interpolation interpolation,
+                          const BorderMode border_mode, const T border,
+                          const float* weights) {
+  const bool constant = (border_mode == BorderMode::CONSTANT);
+  switch (interpolation) {
+    case Interpolation::NEAREST:
+      if (constant) {
+        RemapLoop<T, Cn, Interpolation::NEAREST, BorderMode::CONSTANT>(
+            src, dst, map1, map2, border);
+      } else {
+        RemapLoop<T, Cn, Interpolation::NEAREST, BorderMode::REPLICATE>(
+            src, dst, map1, map2, border);
+      }
+      break;
+    case Interpolation::LINEAR:
+      if (constant) {
+        RemapLoop<T, Cn, Interpolation::LINEAR, BorderMode::CONSTANT>(
+            src, dst, map1, map2, border);
+      } else {
+        RemapLoop<T, Cn, Interpolation::LINEAR, BorderMode::REPLICATE>(
+            src, dst, map1, map2, border);
+      }
+      break;
+    case Interpolation::BICUBIC:
+      if (constant) {
+        RemapKernelLoop<T, Cn, 4, BorderMode::CONSTANT>(src, dst, map1, map2,
+                                                        border, weights);
+      } else {
+        RemapKernelLoop<T, Cn, 4, BorderMode::REPLICATE>(src, dst, map1, map2,
+                                                         border, weights);
+      }
+      break;
+    case Interpolation::LANCZOS3:
+      if (constant) {
+        RemapKernelLoop<T, Cn, 6, BorderMode::CONSTANT>(src, dst, map1, map2,
+                                                        border, weights);
+      } else {
+        RemapKernelLoop<T, Cn, 6, BorderMode::REPLICATE>(src, dst, map1, map2,
+                                                         border, weights);
+      }
+      break;
+  }
+}
+
+/** Remap a source of T, choosing the loop for the number of channels */
+template <typename T>
+static bool RemapDepth(const cv::Mat& src, cv::Mat& dst, const cv::Mat& map1,
+                       const cv::Mat& map2, const Interpolation interpolation,
+                       const BorderMode border_mode, const double border_value,
+                       const float* weights) {
+  const T border = cv::saturate_cast<T>(border_value);
+
+  switch (src.channels()) {
+    case 1:
+      RemapChannels<T, 1>(src, dst, map1, map2, interpolation, border_mode,
+                          border, weights);
+      return true;
+    case 3:
+      RemapChannels<T, 3>(src, dst, map1, map2, interpolation, border_mode,
+                          border, weights);
+      return true;
+    case 4:
+      RemapChannels<T, 4>(src, dst, map1, map2, interpolation, border_mode,
+                          border, weights);
+      return true;
+    default:
+      return false;
+  }
+}
+
+/** Remap a destination region (views of dst, map1 and map2), choosing the
+ *  loop for the depth
+ */
+static bool RemapRegion(const cv::Mat& src, cv::Mat& dst, const cv::Mat& map1,
+                        const cv::Mat& map2, const Interpolation interpolation,
+                        const BorderMode border_mode,
+                        const double border_value, const float* weights) {
+  switch (src.depth()) {
+    case CV_8U:
+      return RemapDepth<uint8_t>(src, dst, map1, map2, interpolation,
+                                 border_mode, border_value, weights);
+    case CV_16U:
+      return RemapDepth<uint16_t>(src, dst, map1, map2, interpolation,
+                                  border_mode, border_value, weights);
+    case CV_32F:
+      return RemapDepth<float>(src, dst, map1, map2, interpolation,
+                               border_mode, border_value, weights);
+    default:
+      return false;
+  }
+}
+
+/** Kernel weights of an interpolation for every fractional position (empty
+ *  for nearest neighbor and bilinear interpolation)
+ */
+static vector<float> InterpolationWeights(const Interpolation interpolation) {
+  if (interpolation == Interpolation::BICUBIC) {
+    return WeightTable(interpolation, 4);
+  } else if (interpolation == Interpolation::LANCZOS3) {
+    return WeightTable(interpolation, 6);
+  }
+  return vector<float>();
+}
+
+/** Bounding box of the source pixels remapping a destination region reads
+ *
+ *  Follows the border handling of the remap loops: locations that take
+ *  the constant border value read nothing and replicated locations read at
+ *  their clamped position; the box is grown by the taps of the kernel.
+ *
+ *  \param[in] src_size       size of the source
+ *  \param[in] map1           horizontal (x) source coordinates of the region
+ *  \param[in] map2           vertical (y) source coordinates of the region
+ *  \param[in] interpolation  interpolation to be used for resampling
+ *  \param[in] border_mode    border mode to be used for out of bounds pixels
+ */
+static cv::Rect SourceFootprint(const cv::Size& src_size, const cv::Mat& map1,
+                                const cv::Mat& map2,
+                                const Interpolation interpolation,
+                                const BorderMode border_mode) {
+  // Source pixels read before and after floor(x) (and floor(y))
+  int first_tap = 0, last_tap = 0;
+  switch (interpolation) {
+    case Interpolation::NEAREST:
+      break;
+    case Interpolation::LINEAR:
+      last_tap = 1;
+      break;
+    case Interpolation::BICUBIC:
+      first_tap = -1;
+      last_tap = 2;
+      break;
+    case Interpolation::LANCZOS3:
+      first_tap = -2;
+      last_tap = 3;
+      break;
+  }
+  const bool nearest = (interpolation == Interpolation::NEAREST);
+  const int last_col = nearest ? src_size.width : src_size.width - 1;
+  const int last_row = nearest ? src_size.height : src_size.height - 1;
+  const bool constant = (border_mode == BorderMode::CONSTANT);
+
+  // Extent of the locations read (NaN never extends it)
+  float min_x = INFINITY, max_x = -INFINITY;
+  float min_y = INFINITY, max_y = -INFINITY;
+  for (int row = 0; row < map1.rows; row++) {
+    const float* map1_row = map1.ptr<float>(row);
+    const float* map2_row = map2.ptr<float>(row);
+    for (int col = 0; col < map1.cols; col++) {
+      const float x = map1_row[col];
+      const float y = map2_row[col];
+      if (constant && (x < 0 || x >= last_col || y < 0 || y >= last_row)) {
+        continue;
+      }
+      if (x < min_x) {
+        min_x = x;
+      }
+      if (x > max_x) {
+        max_x = x;
+      }
+      if (y < min_y) {
+        min_y = y;
+      }
+      if (y > max_y) {
+        max_y = y;
+      }
+    }
+  }
+  if (!(min_x <= max_x) || !(min_y <= max_y)) {
+    return cv::Rect();
+  }
+
+  // Clamped into the image (replicated locations, and what the loops reach
+  // at most), then grown by the taps
+  const double max_col = src_size.width - 1;
+  const double max_row = src_size.height - 1;
+  const int left = (int)floor(std::min(std::max((double)min_x, 0.0), max_col));
+  const int right =
+      (int)floor(std::min(std::max((double)max_x, 0.0), max_col));
+  const int top = (int)floor(std::min(std::max((double)min_y, 0.0), max_row));
+  const int bottom =
+      (int)floor(std::min(std::max((double)max_y, 0.0), max_row));
+  const cv::Rect footprint(left + first_tap, top + first_tap,
+                           right - left + last_tap - first_tap + 1,
+                           bottom - top + last_tap - first_tap + 1);
+  return footprint & cv::Rect(0, 0, src_size.width, src_size.height);
+}
+
 /** Remap source values to the destination array at map1, map2 locations
  *
- *  \param[in] src            source cv::Mat of CV_8UC3
- *  \param[out] dst           destination cv::Mat of CV_8UC3 for remapped values
+ *  Bicubic and Lanczos interpolation use the border modes of bilinear
+ *  interpolation: a location outside [0, cols - 1) x [0, rows - 1) takes
+ *  the border value or is clamped to the image, and kernel taps that
+ *  leave the image repeat its edge pixels.  Their results are rounded and
+ *  saturated to an integer depth.
+ *
+ *  \param[in] src            source cv::Mat of CV_8U, CV_16U or CV_32F with 1,
+ *                            3 or 4 channels
+ *  \param[out] dst           destination cv::Mat of the type of src for
+ *                            remapped values
  *  \param[in] map1           cv::Mat of CV_32FC1 (size of the destination map)
  *                            containing the horizontal (x) coordinates at
  *                            which to resample the source data
@@ -25,137 +406,135 @@ namespace ipcv {
  *                            containing the vertical (y) coordinates at
  *                            which to resample the source data
  *  \param[in] interpolation  interpolation to be used for resampling
- *  \param[in] border_mode    border mode to be used for out-of-bounds pixels
- *  \param[in] border_value   border value to be used when constant border mode
- *                            is to be used
+ *  \param[in] border_mode    border mode to be used for out of bounds pixels
+ *  \param[in] border_value   border value (of every channel, saturated to the
+ *                            depth of src) to be used when constant border
+ *                            mode is to be used
  */
 bool Remap(const cv::Mat& src, cv::Mat& dst, const cv::Mat& map1,
            const cv::Mat& map2, const Interpolation interpolation,
-           const BorderMode border_mode, const uint8_t border_value) {
-  dst.create(map1.size(), src.type());
-
-  double x, y;
-  cv::Point2f remainder;
-
-  // Nearest and Constant
-  if (interpolation == Interpolation::NEAREST &&
-      border_mode == BorderMode::CONSTANT) {
-    for (int row_idx = 0; row_idx < dst.rows; row_idx++) {
-      for (int col_idx = 0; col_idx < dst.cols; col_idx++) {
-        x = map1.at<float>(row_idx, col_idx);
-        y = map2.at<float>(row_idx, col_idx);
-
-        if (x < 0 || x >= src.cols || y < 0 || y >= src.rows) {
-          dst.at<cv::Vec3b>(row_idx, col_idx) =
-              cv::Vec3b(border_value, border_value, border_value);
-        } else {
-          dst.at<cv::Vec3b>(row_idx, col_idx) =
-              src.at<cv::Vec3b>(cv::Point((int)x, (int)y));
-        }
-      }
-    }
+           const BorderMode border_mode, const double border_value) {
+  if (map1.type() != CV_32FC1 || map2.type() != CV_32FC1 ||
+      map1.size() != map2.size()) {
+    return false;
   }
 
-  // Nearest and Replicate
-  if (interpolation == Interpolation::NEAREST &&
-      border_mode == BorderMode::REPLICATE) {
-    for (int row_idx = 0; row_idx < dst.rows; row_idx++) {
-      for (int col_idx = 0; col_idx < dst.cols; col_idx++) {
-        x = map1.at<float>(row_idx, col_idx);
-        y = map2.at<float>(row_idx, col_idx);
+  dst.create(map1.size(), src.type());
 
-        if (x < 0) {
-          x = 0;
-        } else if (x >= src.cols) {
-          x = src.cols - 1;
-        }
+  // Kernel weights for every fractional position, once per call
+  const vector<float> weights = InterpolationWeights(interpolation);
 
-        if (y < 0) {
-          y = 0;
-        } else if (y >= src.rows) {
-          y = src.rows - 1;
-        }
+  return RemapRegion(src, dst, map1, map2, interpolation, border_mode,
+                     border_value, weights.data());
+}
+
+/** Remap a destination tile, quartering it until its source footprint fits
+ *  the cache
+ *
+ *  \param[in] rect      destination pixels of the tile
+ *  \param[out] tiles    tiles remapped, with their source bounding boxes
+ */
+static void RemapTileSplit(const cv::Mat& src, cv::Mat& dst,
+                           const cv::Mat& map1, const cv::Mat& map2,
+                           const Interpolation interpolation,
+                           const BorderMode border_mode,
+                           const double border_value, const float* weights,
+                           const RemapTileOptions& options,
+                           const cv::Rect& rect, vector<RemapTile>& tiles) {
+  const cv::Mat tile_map1 = map1(rect);
+  const cv::Mat tile_map2 = map2(rect);
+  const cv::Rect footprint = SourceFootprint(src.size(), tile_map1, tile_map2,
+                                             interpolation, border_mode);
 
-        dst.at<cv::Vec3b>(row_idx, col_idx) =
-            src.at<cv::Vec3b>(cv::Point((int)x, (int)y));
+  const bool split_cols = rect.width > options.min_tile_size;
+  const bool split_rows = rect.height > options.min_tile_size;
+  if (static_cast<size_t>(footprint.area()) * src.elemSize() >
+          options.cache_bytes &&
+      (split_cols || split_rows)) {
+    const int left_width = split_cols ? rect.width / 2 : rect.width;
+    const int top_height = split_rows ? rect.height / 2 : rect.height;
+    const int xs[] = {rect.x, rect.x + left_width};
+    const int ys[] = {rect.y, rect.y + top_height};
+    const int widths[] = {left_width, rect.width - left_width};
+    const int heights[] = {top_height, rect.height - top_height};
+    for (int i = 0; i < (split_rows ? 2 : 1); i++) {
+      for (int j = 0; j < (split_cols ? 2 : 1); j++) {
+        RemapTileSplit(src, dst, map1, map2, interpolation, border_mode,
+                       border_value, weights, options,
+                       cv::Rect(xs[j], ys[i], widths[j], heights[i]), tiles);
       }
     }
+    return;
   }
 
-  // Bilinear and Constant
-  if (interpolation == Interpolation::LINEAR &&
-      border_mode == BorderMode::CONSTANT) {
-    for (int row_idx = 0; row_idx < dst.rows; row_idx++) {
-      for (int col_idx = 0; col_idx < dst.cols; col_idx++) {
-        x = map1.at<float>(row_idx, col_idx);
-        y = map2.at<float>(row_idx, col_idx);
-
-        if (x < 0 || x >= src.cols - 1 || y < 0 || y >= src.rows - 1) {
-          dst.at<cv::Vec3b>(row_idx, col_idx) =
-              cv::Vec3b(border_value, border_value, border_value);
-        } else {
-          int x1 = (int)floor(x);
-          int y1 = (int)floor(y);
-          int x2 = x1 + 1;
-          int y2 = y1 + 1;
-
-          remainder.x = x - x1;
-          remainder.y = y - y1;
-
-          for (int channel_idx = 0; channel_idx < 3; channel_idx++) {
-            double top =
-                (1 - remainder.x) * src.at<cv::Vec3b>(y1, x1)[channel_idx] +
-                remainder.x * src.at<cv::Vec3b>(y1, x2)[channel_idx];
-            double bottom =
-                (1 - remainder.x) * src.at<cv::Vec3b>(y2, x1)[channel_idx] +
-                remainder.x * src.at<cv::Vec3b>(y2, x2)[channel_idx];
-            dst.at<cv::Vec3b>(row_idx, col_idx)[channel_idx] =
-                (uchar)((1 - remainder.y) * top + remainder.y * bottom);
-          }
-        }
-      }
-    }
+  cv::Mat tile_dst = dst(rect);
+  RemapRegion(src, tile_dst, tile_map1, tile_map2, interpolation, border_mode,
+              border_value, weights);
+  tiles.push_back({rect, footprint});
+}
+
+/** Remap source values to the destination array at map1, map2 locations,
+ *  one destination tile at a time
+ *
+ *  \param[in] src            source cv::Mat of CV_8U, CV_16U or CV_32F with 1,
+ *                            3 or 4 channels
+ *  \param[out] dst           destination cv::Mat of the type of src for
+ *                            remapped values
+ *  \param[in] map1           cv::Mat of CV_32FC1 (size of the destination map)
+ *                            containing the horizontal (x) coordinates at
+ *                            which to resample the source data
+ *  \param[in] map2           cv::Mat of CV_32FC1 (size of the destination map)
+ *                            containing the vertical (y) coordinates at
+ *                            which to resample the source data
+ *  \param[in] interpolation  interpolation to be used for resampling
+ *  \param[in] border_mode    border mode to be used for out of bounds pixels
+ *  \param[in] border_value   border value (of every channel, saturated to the
+ *                            depth of src) to be used when constant border
+ *                            mode is to be used
+ *  \param[in] options        tiling settings
+ *  \param[out] tiles         if not null, receives the tiles with the source
+ *                            bounding box of each
+ */
+bool RemapTiled(const cv::Mat& src, cv::Mat& dst, const cv::Mat& map1,
+                const cv::Mat& map2, const Interpolation interpolation,
+                const BorderMode border_mode, const double border_value,
+                const RemapTileOptions& options, vector<RemapTile>* tiles) {
+  const int depth = src.depth();
+  const int cn = src.channels();
+  if (map1.type() != CV_32FC1 || map2.type() != CV_32FC1 ||
+      map1.size() != map2.size() ||
+      (depth != CV_8U && depth != CV_16U && depth != CV_32F) ||
+      (cn != 1 && cn != 3 && cn != 4) || options.tile_size <= 0 ||
+      options.min_tile_size <= 0) {
+    return false;
   }
 
-  // Bilinear and Replicate
-  if (interpolation == Interpolation::LINEAR &&
-      border_mode == BorderMode::REPLICATE) {
-    for (int row_idx = 0; row_idx < dst.rows; row_idx++) {
-      for (int col_idx = 0; col_idx < dst.cols; col_idx++) {
-        x = map1.at<float>(row_idx, col_idx);
-        y = map2.at<float>(row_idx, col_idx);
+  dst.create(map1.size(), src.type());
+  if (tiles) {
+    tiles->clear();
+  }
+  if (dst.empty()) {
+    return true;
+  }
 
-        if (x < 0) {
-          x = 0;
-        } else if (x >= src.cols - 1) {
-          x = src.cols - 2;
-        }
+  const vector<float> weights = InterpolationWeights(interpolation);
 
-        if (y < 0) {
-          y = 0;
-        } else if (y >= src.rows - 1) {
-          y = src.rows - 2;
-        }
+  // Largest tiles run in parallel, each splitting itself as needed
+  const int columns = (dst.cols + options.tile_size - 1) / options.tile_size;
+  const int rows = (dst.rows + options.tile_size - 1) / options.tile_size;
+  vector<vector<RemapTile>> done(columns * rows);
+  SharedTileExecutor().Run(columns * rows, [&](int index, int) {
+    const int x = (index % columns) * options.tile_size;
+    const int y = (index / columns) * options.tile_size;
+    const cv::Rect rect(x, y, std::min(options.tile_size, dst.cols - x),
+                        std::min(options.tile_size, dst.rows - y));
+    RemapTileSplit(src, dst, map1, map2, interpolation, border_mode,
+                   border_value, weights.data(), options, rect, done[index]);
+  });
 
-        int x1 = (int)floor(x);
-        int y1 = (int)floor(y);
-        int x2 = x1 + 1;
-        int y2 = y1 + 1;
-
-        remainder.x = x - x1;
-        remainder.y = y - y1;
-
-        for (int channel_idx = 0; channel_idx < 3; channel_idx++) {
-          double top =
-              (1 - remainder.x) * src.at<cv::Vec3b>(y1, x1)[channel_idx] +
-              remainder.x * src.at<cv::Vec3b>(y1, x2)[channel_idx];
-          double bottom =
-              (1 - remainder.x) * src.at<cv::Vec3b>(y2, x1)[channel_idx] +
-              remainder.x * src.at<cv::Vec3b>(y2, x2)[channel_idx];
-          dst.at<cv::Vec3b>(row_idx, col_idx)[channel_idx] =
-              (uchar)((1 - remainder.y) * top + remainder.y * bottom);
-        }
-      }
+  if (tiles) {
+    for (const auto& tile_list : done) {
+      tiles->insert(tiles->end(), tile_list.begin(), tile_list.end());
     }
   }
 
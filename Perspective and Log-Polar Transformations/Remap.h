@@ -7,6 +7,9 @@
 
 #pragma once
 
+#include <cstddef>
+#include <vector>
+
 #include <opencv2/core.hpp>
 
 #include <Eigen/Dense>
@@ -16,7 +19,9 @@ namespace ipcv {
 // Available interpolation types
 enum class Interpolation {
   NEAREST,  // Nearest neighbor interpolation
-  LINEAR  // Bilinear interpolation
+  LINEAR,  // Bilinear interpolation
+  BICUBIC,  // Bicubic (Keys, a = -0.5) interpolation over 4 x 4 pixels
+  LANCZOS3  // Lanczos (a = 3) interpolation over 6 x 6 pixels
 };
 
 // Available border modes
@@ -27,8 +32,16 @@ enum class BorderMode {
 
 /** Remap source values to the destination array at map1, map2 locations
  *
- *  \param[in] src            source cv::Mat of CV_8UC3
- *  \param[out] dst           destination cv::Mat of CV_8UC3 for remapped values
+ *  Bicubic and Lanczos interpolation use the border modes of bilinear
+ *  interpolation: a location outside [0, cols - 1) x [0, rows - 1) takes
+ *  the border value or is clamped to the image, and kernel taps that
+ *  leave the image repeat its edge pixels.  Their results are rounded and
+ *  saturated to an integer depth.
+ *
+ *  \param[in] src            source cv::Mat of CV_8U, CV_16U or CV_32F with 1,
+ *                            3 or 4 channels
+ *  \param[out] dst           destination cv::Mat of the type of src for
+ *                            remapped values
  *  \param[in] map1           cv::Mat of CV_32FC1 (size of the destination map)
  *                            containing the horizontal (x) coordinates at
  *                            which to resample the source data
@@ -37,12 +50,76 @@ enum class BorderMode {
  *                            which to resample the source data
  *  \param[in] interpolation  interpolation to be used for resampling
  *  \param[in] border_mode    border mode to be used for out of bounds pixels
- *  \param[in] border_value   border value to be used when constant border mode
- *                            is to be used
+ *  \param[in] border_value   border value (of every channel, saturated to the
+ *                            depth of src) to be used when constant border
+ *                            mode is to be used
  */
 bool Remap(const cv::Mat& src, cv::Mat& dst, const cv::Mat& map1,
            const cv::Mat& map2,
            const Interpolation interpolation = Interpolation::NEAREST,
            const BorderMode border_mode = BorderMode::CONSTANT,
-           const uint8_t border_value = 0);
+           const double border_value = 0);
+
+/** Destination tile of RemapTiled and the source pixels it read
+ *
+ *  \var dst  destination pixels of the tile
+ *  \var src  bounding box of the source pixels the tile read (empty when
+ *            every pixel of the tile took the border value)
+ */
+struct RemapTile {
+  cv::Rect dst;
+  cv::Rect src;
+};
+
+/** Tiling settings of RemapTiled
+ *
+ *  \var cache_bytes    source bytes the footprint of a tile is sized to fit
+ *                      in, about the size of a per-core L2 cache
+ *  \var tile_size      destination pixels across the largest tiles
+ *  \var min_tile_size  destination pixels across the smallest tiles, below
+ *                      which a tile is not split further
+ */
+struct RemapTileOptions {
+  std::size_t cache_bytes = 256 * 1024;
+  int tile_size = 256;
+  int min_tile_size = 16;
+};
+
+/** Remap source values to the destination array at map1, map2 locations,
+ *  one destination tile at a time
+ *
+ *  Tiles are quartered until the bounding box of the source pixels they
+ *  read fits in options.cache_bytes, so that warps sweeping the source
+ *  diagonally (large rotations) reuse the source pixels they bring into the
+ *  cache; the tiles run in parallel on the shared tile executor.  Every
+ *  destination pixel is computed exactly as Remap computes it, so the
+ *  output is identical to Remap's.
+ *
+ *  \param[in] src            source cv::Mat of CV_8U, CV_16U or CV_32F with 1,
+ *                            3 or 4 channels
+ *  \param[out] dst           destination cv::Mat of the type of src for
+ *                            remapped values
+ *  \param[in] map1           cv::Mat of CV_32FC1 (size of the destination map)
+ *                            containing the horizontal (x) coordinates at
+ *                            which to resample the source data
+ *  \param[in] map2           cv::Mat of CV_32FC1 (size of the destination map)
+ *                            containing the vertical (y) coordinates at
+ *                            which to resample the source data
+ *  \param[in] interpolation  interpolation to be used for resampling
+ *  \param[in] border_mode    border mode to be used for out of bounds pixels
+ *  \param[in] border_value   border value (of every channel, saturated to the
+ *                            depth of src) to be used when constant border
+ *                            mode is to be used
+ *  \param[in] options        tiling settings
+ *  \param[out] tiles         if not null, receives the tiles with the source
+ *                            bounding box of each (in row-major order of the
+ *                            largest tiles)
+ */
+bool RemapTiled(const cv::Mat& src, cv::Mat& dst, const cv::Mat& map1,
+                const cv::Mat& map2,
+                const Interpolation interpolation = Interpolation::NEAREST,
+                const BorderMode border_mode = BorderMode::CONSTANT,
+                const double border_value = 0,
+                const RemapTileOptions& options = RemapTileOptions(),
+                std::vector<RemapTile>* tiles = nullptr);
 }
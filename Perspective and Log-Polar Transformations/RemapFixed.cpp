@@ -0,0 +1,576 @@
+/** Implementation file for remapping source values through fixed-point maps
+ *
+ *  \file ipcv/geometric_transformation/RemapFixed.cpp
+ *  \author Anthony Guarino (ag4933@rit.edu)
+ *  \date 16 Oct 2026
+ */
+
+#include "RemapFixed.h"
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#define IPCV_REMAP_X86 1
+#include <immintrin.h>
+#endif
+
+using namespace std;
+
+namespace ipcv {
+
+// Fractions of a pixel per coordinate and the mask of one coordinate's
+// fraction in a fraction index
+static const int kFractions = 1 << kRemapFractionBits;
+static const int kFractionMask = kFractions - 1;
+
+// Bits of the bilinear weights; the four weights of every fraction index
+// sum to 1 << kWeightBits, so a weight times 255 still fits madd's 16-bit
+// operands and 32-bit sums
+static const int kWeightBits = 14;
+
+/** Fixed-point bilinear weights (top left, top right, bottom left, bottom
+ *  right) of every fraction index
+ */
+struct BilinearWeights {
+  BilinearWeights();
+
+  alignas(16) int16_t weights[kFractions * kFractions][4];
+};
+
+/** Round the exact weights, giving the rounding error to the largest */
+BilinearWeights::BilinearWeights() {
+  for (int fy = 0; fy < kFractions; fy++) {
+    for (int fx = 0; fx < kFractions; fx++) {
+      const double x = static_cast<double>(fx) / kFractions;
+      const double y = static_cast<double>(fy) / kFractions;
+      const double exact[4] = {(1 - x) * (1 - y), x * (1 - y), (1 - x) * y,
+                               x * y};
+
+      int16_t* w = weights[(fy << kRemapFractionBits) + fx];
+      int sum = 0;
+      int largest = 0;
+      for (int k = 0; k < 4; k++) {
+        w[k] = static_cast<int16_t>(std::lround(exact[k] * (1 << kWeightBits)));
+        sum += w[k];
+        if (w[k] > w[largest]) {
+          largest = k;
+        }
+      }
+      w[largest] += (1 << kWeightBits) - sum;
+    }
+  }
+}
+
+static const BilinearWeights& Weights() {
+  static const BilinearWeights table;
+  return table;
+}
+
+/** Source coordinate in 1/kFractions of a pixel, clamped so that its
+ *  integer part fits 16 bits (NaN lands below the range)
+ */
+static inline int FixedCoordinate(const float value) {
+  const double lowest = INT16_MIN;
+  const double highest = INT16_MAX + 1.0 - 1.0 / kFractions;
+  double coordinate = value;
+  if (!(coordinate >= lowest)) {
+    coordinate = lowest;
+  } else if (coordinate > highest) {
+    coordinate = highest;
+  }
+  return static_cast<int>(std::floor(coordinate * kFractions));
+}
+
+#if IPCV_REMAP_X86
+/** AVX2 map conversion of one row, eight locations per iteration
+ *
+ *  \param[in] x         horizontal coordinates of the row
+ *  \param[in] y         vertical coordinates of the row
+ *  \param[in] length    locations in the row
+ *  \param[out] integer  integer source column and row of the row
+ *  \param[out] index    fraction indices of the row (nullptr for nearest)
+ *
+ *  \return number of locations converted (a multiple of eight)
+ */
+__attribute__((target("avx2"))) static int ConvertRowAvx2(
+    const float* x, const float* y, const int length, int16_t* integer,
+    uint16_t* index) {
+  const __m256 lowest = _mm256_set1_ps(INT16_MIN);
+  const __m256 highest = _mm256_set1_ps(INT16_MAX + 1.0f - 1.0f / kFractions);
+  const __m256 scale = _mm256_set1_ps(kFractions);
+  const __m256i mask = _mm256_set1_epi32(kFractionMask);
+  const __m256i low = _mm256_set1_epi32(0xFFFF);
+
+  int j = 0;
+  for (; j + 8 <= length; j += 8) {
+    // max_ps returns its second operand for NaN, as FixedCoordinate does
+    const __m256i fixed_x = _mm256_cvttps_epi32(_mm256_floor_ps(_mm256_mul_ps(
+        _mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(x + j), lowest), highest),
+        scale)));
+    const __m256i fixed_y = _mm256_cvttps_epi32(_mm256_floor_ps(_mm256_mul_ps(
+        _mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(y + j), lowest), highest),
+        scale)));
+
+    _mm256_storeu_si256(
+        reinterpret_cast<__m256i*>(integer + 2 * j),
+        _mm256_or_si256(
+            _mm256_and_si256(_mm256_srai_epi32(fixed_x, kRemapFractionBits),
+                             low),
+            _mm256_slli_epi32(_mm256_srai_epi32(fixed_y, kRemapFractionBits),
+                              16)));
+
+    if (index) {
+      const __m256i fractions = _mm256_or_si256(
+          _mm256_slli_epi32(_mm256_and_si256(fixed_y, mask),
+                            kRemapFractionBits),
+          _mm256_and_si256(fixed_x, mask));
+      const __m256i words = _mm256_permute4x64_epi64(
+          _mm256_packus_epi32(fractions, fractions), 0x08);
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(index + j),
+                       _mm256_castsi256_si128(words));
+    }
+  }
+
+  return j;
+}
+
+static bool HasAvx2() {
+  static const bool avx2 = __builtin_cpu_supports("avx2");
+  return avx2;
+}
+#endif
+
+/** Convert one row of floating point locations into fixed-point locations
+ *
+ *  \param[in] x          horizontal source coordinates
+ *  \param[in] y          vertical source coordinates
+ *  \param[in] length     number of locations
+ *  \param[out] xy        integer source column and row of every location
+ *  \param[out] fraction  fraction index of every location (nullptr for
+ *                        nearest neighbor interpolation)
+ */
+void ConvertRowFixed(const float* x, const float* y, const int length,
+                     int16_t* xy, uint16_t* fraction) {
+  int col = 0;
+#if IPCV_REMAP_X86
+  if (HasAvx2()) {
+    col = ConvertRowAvx2(x, y, length, xy, fraction);
+  }
+#endif
+  for (; col < length; col++) {
+    const int fixed_x = FixedCoordinate(x[col]);
+    const int fixed_y = FixedCoordinate(y[col]);
+    xy[2 * col] = static_cast<int16_t>(fixed_x >> kRemapFractionBits);
+    xy[2 * col + 1] = static_cast<int16_t>(fixed_y >> kRemapFractionBits);
+    if (fraction) {
+      fraction[col] = static_cast<uint16_t>(
+          ((fixed_y & kFractionMask) << kRemapFractionBits) +
+          (fixed_x & kFractionMask));
+    }
+  }
+}
+
+/** Convert floating point maps once into fixed-point maps for RemapFixed
+ *
+ *  \param[in] map1           cv::Mat of CV_32FC1 containing the horizontal
+ *                            (x) coordinates at which to resample the source
+ *  \param[in] map2           cv::Mat of CV_32FC1 containing the vertical (y)
+ *                            coordinates at which to resample the source
+ *  \param[out] xy            cv::Mat of CV_16SC2 of the integer source column
+ *                            and row of every location
+ *  \param[out] fraction      cv::Mat of CV_16UC1 of the fraction index of
+ *                            every location
+ *  \param[in] interpolation  interpolation the maps will be used with (nearest
+ *                            neighbor or bilinear)
+ */
+bool ConvertMapsFixed(const cv::Mat& map1, const cv::Mat& map2, cv::Mat& xy,
+                      cv::Mat& fraction, const Interpolation interpolation) {
+  if (map1.empty() || map1.type() != CV_32FC1 || map2.type() != CV_32FC1 ||
+      map1.size() != map2.size() ||
+      (interpolation != Interpolation::NEAREST &&
+       interpolation != Interpolation::LINEAR)) {
+    return false;
+  }
+
+  const bool linear = (interpolation == Interpolation::LINEAR);
+  xy.create(map1.size(), CV_16SC2);
+  if (linear) {
+    fraction.create(map1.size(), CV_16UC1);
+  } else {
+    fraction.release();
+  }
+
+  for (int row = 0; row < map1.rows; row++) {
+    ConvertRowFixed(map1.ptr<float>(row), map2.ptr<float>(row), map1.cols,
+                    xy.ptr<int16_t>(row),
+                    linear ? fraction.ptr<uint16_t>(row) : nullptr);
+  }
+
+  return true;
+}
+
+/** Scalar remap of destination pixels [first, end) of one row
+ *
+ *  \param[in] src       source cv::Mat
+ *  \param[in] xy        integer source column and row of the row
+ *  \param[in] fraction  fraction indices of the row (nullptr for nearest)
+ *  \param[in] first     first destination pixel
+ *  \param[in] end       one past the last destination pixel
+ *  \param[in] constant  true for the constant border mode
+ *  \param[in] border    border value
+ *  \param[out] dst      destination row
+ */
+static void RemapRowScalar(const cv::Mat& src, const int16_t* xy,
+                           const uint16_t* fraction, const int first,
+                           const int end, const bool constant,
+                           const uint8_t border, uint8_t* dst) {
+  const int cn = src.channels();
+  const size_t step = src.step;
+  const int16_t(*weights)[4] = Weights().weights;
+
+  for (int j = first; j < end; j++) {
+    int x = xy[2 * j];
+    int y = xy[2 * j + 1];
+    uint8_t* out = dst + j * cn;
+
+    if (!fraction) {
+      if (constant) {
+        if (x < 0 || x >= src.cols || y < 0 || y >= src.rows) {
+          std::fill(out, out + cn, border);
+          continue;
+        }
+      } else {
+        x = std::min(std::max(x, 0), src.cols - 1);
+        y = std::min(std::max(y, 0), src.rows - 1);
+      }
+      std::memcpy(out, src.data + y * step + x * cn, cn);
+      continue;
+    }
+
+    int index = fraction[j];
+    if (constant) {
+      if (x < 0 || x >= src.cols - 1 || y < 0 || y >= src.rows - 1) {
+        std::fill(out, out + cn, border);
+        continue;
+      }
+    } else {
+      // Clamped coordinates lose their fraction, as in Remap
+      if (x < 0 || x > src.cols - 2) {
+        x = std::min(std::max(x, 0), src.cols - 2);
+        index &= kFractionMask << kRemapFractionBits;
+      }
+      if (y < 0 || y > src.rows - 2) {
+        y = std::min(std::max(y, 0), src.rows - 2);
+        index &= kFractionMask;
+      }
+    }
+
+    const uint8_t* top = src.data + y * step + x * cn;
+    const uint8_t* bottom = top + step;
+    const int16_t* w = weights[index];
+    for (int c = 0; c < cn; c++) {
+      const int sum = w[0] * top[c] + w[1] * top[c + cn] + w[2] * bottom[c] +
+                      w[3] * bottom[c + cn] + (1 << (kWeightBits - 1));
+      out[c] = static_cast<uint8_t>(sum >> kWeightBits);
+    }
+  }
+}
+
+#if IPCV_REMAP_X86
+/** Store eight pixels held one per 32-bit lane (channel c in byte c) */
+template <int Cn>
+__attribute__((target("avx2"))) static inline void StorePixelsAvx2(
+    const __m256i pixels, uint8_t* dst) {
+  if (Cn == 4) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), pixels);
+    return;
+  }
+
+  const __m256i pack =
+      (Cn == 3) ? _mm256_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1,
+                                   -1, -1, -1, 0, 1, 2, 4, 5, 6, 8, 9, 10, 12,
+                                   13, 14, -1, -1, -1, -1)
+                : _mm256_setr_epi8(0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1,
+                                   -1, -1, -1, -1, 0, 4, 8, 12, -1, -1, -1, -1,
+                                   -1, -1, -1, -1, -1, -1, -1, -1);
+  const __m256i packed = _mm256_shuffle_epi8(pixels, pack);
+  const __m128i halves[2] = {_mm256_castsi256_si128(packed),
+                             _mm256_extracti128_si256(packed, 1)};
+  for (int h = 0; h < 2; h++) {
+    uint8_t* out = dst + h * 4 * Cn;
+    if (Cn == 3) {
+      _mm_storel_epi64(reinterpret_cast<__m128i*>(out), halves[h]);
+      const int last = _mm_cvtsi128_si32(_mm_srli_si128(halves[h], 8));
+      std::memcpy(out + 8, &last, 4);
+    } else {
+      const int all = _mm_cvtsi128_si32(halves[h]);
+      std::memcpy(out, &all, 4);
+    }
+  }
+}
+
+/** Bilinear interpolation of four destination pixels whose source pixels
+ *  and right neighbours were gathered as one 64-bit lane per pixel, top
+ *  and bottom row apart
+ *
+ *  \return channel c of pixel k as 16-bit value c of 64-bit lane k
+ */
+template <int Cn>
+__attribute__((target("avx2"))) static inline __m256i InterpolateFourAvx2(
+    const __m256i top, const __m256i bottom, const __m256i weights) {
+  // Channel c of the left and right pixels side by side, so that one madd
+  // weighs both
+  const __m256i pair =
+      (Cn == 4) ? _mm256_setr_epi8(0, 4, 1, 5, 2, 6, 3, 7, 8, 12, 9, 13, 10,
+                                   14, 11, 15, 0, 4, 1, 5, 2, 6, 3, 7, 8, 12,
+                                   9, 13, 10, 14, 11, 15)
+      : (Cn == 3)
+          ? _mm256_setr_epi8(0, 3, 1, 4, 2, 5, -1, -1, 8, 11, 9, 12, 10, 13,
+                             -1, -1, 0, 3, 1, 4, 2, 5, -1, -1, 8, 11, 9, 12,
+                             10, 13, -1, -1)
+          : _mm256_setr_epi8(0, 1, -1, -1, -1, -1, -1, -1, 8, 9, -1, -1, -1,
+                             -1, -1, -1, 0, 1, -1, -1, -1, -1, -1, -1, 8, 9,
+                             -1, -1, -1, -1, -1, -1);
+  const __m256i zero = _mm256_setzero_si256();
+  const __m256i round = _mm256_set1_epi32(1 << (kWeightBits - 1));
+  const __m256i top_pairs = _mm256_shuffle_epi8(top, pair);
+  const __m256i bottom_pairs = _mm256_shuffle_epi8(bottom, pair);
+
+  // Even and odd lanes of each 128-bit half
+  __m256i sums[2];
+  for (int k = 0; k < 2; k++) {
+    const __m256i top_words = k ? _mm256_unpackhi_epi8(top_pairs, zero)
+                                : _mm256_unpacklo_epi8(top_pairs, zero);
+    const __m256i bottom_words = k ? _mm256_unpackhi_epi8(bottom_pairs, zero)
+                                   : _mm256_unpacklo_epi8(bottom_pairs, zero);
+    const __m256i top_weights = k ? _mm256_shuffle_epi32(weights, 0xAA)
+                                  : _mm256_shuffle_epi32(weights, 0x00);
+    const __m256i bottom_weights = k ? _mm256_shuffle_epi32(weights, 0xFF)
+                                     : _mm256_shuffle_epi32(weights, 0x55);
+    const __m256i sum =
+        _mm256_add_epi32(_mm256_madd_epi16(top_words, top_weights),
+                         _mm256_madd_epi16(bottom_words, bottom_weights));
+    sums[k] = _mm256_srli_epi32(_mm256_add_epi32(sum, round), kWeightBits);
+  }
+  return _mm256_packus_epi32(sums[0], sums[1]);
+}
+
+/** AVX2 remap of one row, eight destination pixels per iteration
+ *
+ *  Nearest neighbor fetches every pixel as one 32-bit gather lane, bilinear
+ *  every pixel and its right neighbour as one 64-bit lane (the bytes past
+ *  the channels are discarded), so a group whose reads could run past the
+ *  end of the source falls back to the scalar remap.
+ *
+ *  \param[in] src       source cv::Mat of Cn channels
+ *  \param[in] xy        integer source column and row of the row
+ *  \param[in] fraction  fraction indices of the row (nullptr for nearest)
+ *  \param[in] length    destination pixels in the row
+ *  \param[in] constant  true for the constant border mode
+ *  \param[in] border    border value
+ *  \param[out] dst      destination row
+ *
+ *  \return number of destination pixels remapped (a multiple of eight)
+ */
+template <int Cn>
+__attribute__((target("avx2"))) static int RemapRowAvx2(
+    const cv::Mat& src, const int16_t* xy, const uint16_t* fraction,
+    const int length, const bool constant, const uint8_t border,
+    uint8_t* dst) {
+  const bool linear = (fraction != nullptr);
+  const int step = static_cast<int>(src.step);
+
+  // Largest gather offset whose reads stay inside the source
+  const long readable =
+      static_cast<long>(src.rows - 1) * step + static_cast<long>(src.cols) * Cn;
+  const long last = linear ? readable - 8 - step : readable - 4;
+  if (last < 0) {
+    return 0;
+  }
+
+  // One past the largest column and row whose samples stay in the image
+  const __m256i cols = _mm256_set1_epi32(linear ? src.cols - 1 : src.cols);
+  const __m256i rows = _mm256_set1_epi32(linear ? src.rows - 1 : src.rows);
+  const __m256i one = _mm256_set1_epi32(1);
+  const __m256i zero = _mm256_setzero_si256();
+  const __m256i all = _mm256_set1_epi32(-1);
+  const __m256i steps = _mm256_set1_epi32(step);
+  const __m256i channels = _mm256_set1_epi32(Cn);
+  const __m256i last_offset = _mm256_set1_epi32(static_cast<int>(last));
+  const __m256i x_fraction = _mm256_set1_epi32(kFractionMask);
+  const __m256i y_fraction =
+      _mm256_set1_epi32(kFractionMask << kRemapFractionBits);
+  const __m256i order = _mm256_setr_epi32(0, 1, 4, 5, 2, 3, 6, 7);
+  const __m256i borders = _mm256_set1_epi32(
+      static_cast<int>(border * 0x01010101u));
+
+  const int* pixels32 = reinterpret_cast<const int*>(src.data);
+  const long long* pixels64 = reinterpret_cast<const long long*>(src.data);
+  const long long* below64 =
+      reinterpret_cast<const long long*>(src.data + step);
+  const long long* table =
+      reinterpret_cast<const long long*>(Weights().weights);
+
+  int j = 0;
+  for (; j + 8 <= length; j += 8) {
+    const __m256i packed =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(xy + 2 * j));
+    __m256i x = _mm256_srai_epi32(_mm256_slli_epi32(packed, 16), 16);
+    __m256i y = _mm256_srai_epi32(packed, 16);
+    __m256i index = zero;
+    if (linear) {
+      index = _mm256_cvtepu16_epi32(
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(fraction + j)));
+    }
+
+    __m256i inside = all;
+    if (constant) {
+      inside = _mm256_and_si256(
+          _mm256_and_si256(_mm256_cmpgt_epi32(x, all),
+                           _mm256_cmpgt_epi32(cols, x)),
+          _mm256_and_si256(_mm256_cmpgt_epi32(y, all),
+                           _mm256_cmpgt_epi32(rows, y)));
+      if (_mm256_movemask_epi8(inside) == 0) {
+        StorePixelsAvx2<Cn>(borders, dst + j * Cn);
+        continue;
+      }
+      x = _mm256_and_si256(x, inside);
+      y = _mm256_and_si256(y, inside);
+    } else {
+      // Clamped coordinates lose their fraction, as in Remap
+      const __m256i clamped_x = _mm256_min_epi32(_mm256_max_epi32(x, zero),
+                                                 _mm256_sub_epi32(cols, one));
+      const __m256i clamped_y = _mm256_min_epi32(_mm256_max_epi32(y, zero),
+                                                 _mm256_sub_epi32(rows, one));
+      if (linear) {
+        index = _mm256_and_si256(
+            index, _mm256_or_si256(
+                       _mm256_and_si256(_mm256_cmpeq_epi32(clamped_x, x),
+                                        x_fraction),
+                       _mm256_and_si256(_mm256_cmpeq_epi32(clamped_y, y),
+                                        y_fraction)));
+      }
+      x = clamped_x;
+      y = clamped_y;
+    }
+
+    const __m256i offset = _mm256_add_epi32(_mm256_mullo_epi32(y, steps),
+                                            _mm256_mullo_epi32(x, channels));
+    if (_mm256_movemask_epi8(_mm256_cmpgt_epi32(offset, last_offset)) != 0) {
+      RemapRowScalar(src, xy, fraction, j, j + 8, constant, border, dst);
+      continue;
+    }
+
+    __m256i pixels;
+    if (!linear) {
+      pixels = _mm256_i32gather_epi32(pixels32, offset, 1);
+    } else {
+      __m256i halves[2];
+      for (int h = 0; h < 2; h++) {
+        const __m128i lanes = h ? _mm256_extracti128_si256(offset, 1)
+                                : _mm256_castsi256_si128(offset);
+        const __m128i entries = h ? _mm256_extracti128_si256(index, 1)
+                                  : _mm256_castsi256_si128(index);
+        halves[h] = InterpolateFourAvx2<Cn>(
+            _mm256_i32gather_epi64(pixels64, lanes, 1),
+            _mm256_i32gather_epi64(below64, lanes, 1),
+            _mm256_i32gather_epi64(table, entries, 8));
+      }
+
+      // 32-bit lanes come out as pixels 0 1 4 5 2 3 6 7
+      pixels = _mm256_permutevar8x32_epi32(
+          _mm256_packus_epi16(halves[0], halves[1]), order);
+    }
+
+    if (constant) {
+      pixels = _mm256_blendv_epi8(borders, pixels, inside);
+    }
+    StorePixelsAvx2<Cn>(pixels, dst + j * Cn);
+  }
+
+  return j;
+}
+#endif
+
+/** Remap one row of destination pixels through fixed-point locations
+ *
+ *  \param[in] src           source cv::Mat of CV_8UC1, CV_8UC3 or CV_8UC4
+ *  \param[in] xy            integer source column and row of every pixel
+ *  \param[in] fraction      fraction index of every pixel (nullptr for
+ *                           nearest neighbor interpolation)
+ *  \param[in] length        number of destination pixels
+ *  \param[in] border_mode   border mode to be used for out-of-bounds pixels
+ *  \param[in] border_value  border value to be used when constant border mode
+ *                           is to be used
+ *  \param[out] dst          destination pixels
+ */
+void RemapFixedRow(const cv::Mat& src, const int16_t* xy,
+                   const uint16_t* fraction, const int length,
+                   const BorderMode border_mode, const uint8_t border_value,
+                   uint8_t* dst) {
+  const bool constant = (border_mode == BorderMode::CONSTANT);
+
+  int done = 0;
+#if IPCV_REMAP_X86
+  if (HasAvx2() && static_cast<double>(src.step) * src.rows < INT_MAX) {
+    const int cn = src.channels();
+    if (cn == 1) {
+      done = RemapRowAvx2<1>(src, xy, fraction, length, constant,
+                             border_value, dst);
+    } else if (cn == 3) {
+      done = RemapRowAvx2<3>(src, xy, fraction, length, constant,
+                             border_value, dst);
+    } else {
+      done = RemapRowAvx2<4>(src, xy, fraction, length, constant,
+                             border_value, dst);
+    }
+  }
+#endif
+  RemapRowScalar(src, xy, fraction, done, length, constant, border_value, dst);
+}
+
+/** Remap source values to the destination array through fixed-point maps
+ *
+ *  \param[in] src            source cv::Mat of CV_8UC1, CV_8UC3 or CV_8UC4
+ *  \param[out] dst           destination cv::Mat of the type of src and the
+ *                            size of xy for remapped values
+ *  \param[in] xy             cv::Mat of CV_16SC2 from ConvertMapsFixed
+ *  \param[in] fraction       cv::Mat of CV_16UC1 from ConvertMapsFixed
+ *  \param[in] interpolation  interpolation to be used for resampling (nearest
+ *                            neighbor or bilinear)
+ *  \param[in] border_mode    border mode to be used for out-of-bounds pixels
+ *  \param[in] border_value   border value to be used when constant border mode
+ *                            is to be used
+ */
+bool RemapFixed(const cv::Mat& src, cv::Mat& dst, const cv::Mat& xy,
+                const cv::Mat& fraction, const Interpolation interpolation,
+                const BorderMode border_mode, const uint8_t border_value) {
+  const int cn = src.channels();
+  const bool linear = (interpolation == Interpolation::LINEAR);
+  if (src.empty() || src.depth() != CV_8U || (cn != 1 && cn != 3 && cn != 4) ||
+      src.cols > INT16_MAX || src.rows > INT16_MAX || xy.empty() ||
+      xy.type() != CV_16SC2 ||
+      (interpolation != Interpolation::NEAREST && !linear)) {
+    return false;
+  }
+  if (linear && (src.cols < 2 || src.rows < 2 ||
+                 fraction.type() != CV_16UC1 || fraction.size() != xy.size())) {
+    return false;
+  }
+
+  const cv::Mat source = (src.data == dst.data) ? src.clone() : src;
+  dst.create(xy.size(), source.type());
+
+  for (int row = 0; row < dst.rows; row++) {
+    RemapFixedRow(source, xy.ptr<int16_t>(row),
+                  linear ? fraction.ptr<uint16_t>(row) : nullptr, dst.cols,
+                  border_mode, border_value, dst.ptr<uint8_t>(row));
+  }
+
+  return true;
+}
+}
@@ -0,0 +1,106 @@
+/** Interface file for remapping source values through fixed-point maps
+ *
+ *  \file ipcv/geometric_transformation/RemapFixed.h
+ *  \author Anthony Guarino (ag4933@rit.edu)
+ *  \date 16 Oct 2026
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include <opencv2/core.hpp>
+
+#include "Remap.h"
+
+namespace ipcv {
+
+// Fractional bits kept for each coordinate of a fixed-point map (1/32 of a
+// pixel)
+const int kRemapFractionBits = 5;
+
+/** Convert floating point maps once into fixed-point maps for RemapFixed
+ *
+ *  Every location is split into the integer (floor) source column and row
+ *  and, for bilinear interpolation, the index
+ *  (row fraction << kRemapFractionBits) + column fraction of its
+ *  kRemapFractionBits-bit fractional parts.  Locations beyond the range of
+ *  a 16-bit integer are clamped to it.
+ *
+ *  \param[in] map1           cv::Mat of CV_32FC1 containing the horizontal
+ *                            (x) coordinates at which to resample the source
+ *  \param[in] map2           cv::Mat of CV_32FC1 containing the vertical (y)
+ *                            coordinates at which to resample the source
+ *  \param[out] xy            cv::Mat of CV_16SC2 of the integer source column
+ *                            and row of every location
+ *  \param[out] fraction      cv::Mat of CV_16UC1 of the fraction index of
+ *                            every location (left empty for nearest
+ *                            neighbor interpolation)
+ *  \param[in] interpolation  interpolation the maps will be used with (nearest
+ *                            neighbor or bilinear)
+ */
+bool ConvertMapsFixed(const cv::Mat& map1, const cv::Mat& map2, cv::Mat& xy,
+                      cv::Mat& fraction,
+                      const Interpolation interpolation = Interpolation::LINEAR);
+
+/** Convert one row of floating point locations into fixed-point locations
+ *  (ConvertMapsFixed a row at a time, for warps that compute their
+ *  locations on the fly)
+ *
+ *  \param[in] x          horizontal source coordinates
+ *  \param[in] y          vertical source coordinates
+ *  \param[in] length     number of locations
+ *  \param[out] xy        integer source column and row of every location
+ *  \param[out] fraction  fraction index of every location (nullptr for
+ *                        nearest neighbor interpolation)
+ */
+void ConvertRowFixed(const float* x, const float* y, const int length,
+                     int16_t* xy, uint16_t* fraction);
+
+/** Remap one row of destination pixels through fixed-point locations
+ *  (RemapFixed a row at a time; the source is not checked)
+ *
+ *  \param[in] src           source cv::Mat of CV_8UC1, CV_8UC3 or CV_8UC4 (at
+ *                           most 32767 x 32767, at least 2 x 2 for bilinear
+ *                           interpolation)
+ *  \param[in] xy            integer source column and row of every pixel
+ *  \param[in] fraction      fraction index of every pixel (nullptr for
+ *                           nearest neighbor interpolation)
+ *  \param[in] length        number of destination pixels
+ *  \param[in] border_mode   border mode to be used for out of bounds pixels
+ *  \param[in] border_value  border value to be used when constant border mode
+ *                           is to be used
+ *  \param[out] dst          destination pixels
+ */
+void RemapFixedRow(const cv::Mat& src, const int16_t* xy,
+                   const uint16_t* fraction, const int length,
+                   const BorderMode border_mode, const uint8_t border_value,
+                   uint8_t* dst);
+
+/** Remap source values to the destination array through fixed-point maps
+ *
+ *  Samples the same source pixels as Remap, with the same border handling;
+ *  bilinear weights come from a table of 14-bit fixed-point weights for
+ *  every fraction index, so interpolated values differ from Remap by the
+ *  rounding of the location to 1/32 of a pixel (and of the result, which
+ *  Remap truncates).
+ *
+ *  \param[in] src            source cv::Mat of CV_8UC1, CV_8UC3 or CV_8UC4 (at
+ *                            most 32767 x 32767)
+ *  \param[out] dst           destination cv::Mat of the type of src and the
+ *                            size of xy for remapped values
+ *  \param[in] xy             cv::Mat of CV_16SC2 from ConvertMapsFixed
+ *  \param[in] fraction       cv::Mat of CV_16UC1 from ConvertMapsFixed
+ *                            (ignored for nearest neighbor interpolation)
+ *  \param[in] interpolation  interpolation to be used for resampling (nearest
+ *                            neighbor or bilinear)
+ *  \param[in] border_mode    border mode to be used for out of bounds pixels
+ *  \param[in] border_value   border value to be used when constant border mode
+ *                            is to be used
+ */
+bool RemapFixed(const cv::Mat& src, cv::Mat& dst, const cv::Mat& xy,
+                const cv::Mat& fraction,
+                const Interpolation interpolation = Interpolation::NEAREST,
+                const BorderMode border_mode = BorderMode::CONSTANT,
+                const uint8_t border_value = 0);
+}
@@ -0,0 +1,112 @@
+/** Interface file for resampling one source location the way Remap does
+ *
+ *  \file ipcv/geometric_transformation/RemapPixel.h
+ *  \author Anthony Guarino (ag4933@rit.edu)
+ *  \date 16 Oct 2026
+ */
+
+#pragma once
+
+#include <cmath>
+
+#include <opencv2/core.hpp>
+
+#include "Remap.h"
+
+namespace ipcv {
+
+/** Resample the source at one location with nearest neighbor interpolation
+ *  (the per-pixel step of Remap, for a map value of (x, y))
+ *
+ *  \param[in] src     source cv::Mat of Cn channels of T
+ *  \param[in] x       horizontal source coordinate
+ *  \param[in] y       vertical source coordinate
+ *  \param[in] border  border value of every channel for the constant border
+ *                     mode
+ *  \param[out] dst    channels of the destination pixel
+ */
+template <typename T, int Cn, BorderMode B>
+inline void RemapPixelNearest(const cv::Mat& src, double x, double y,
+                              const T border, T* dst) {
+  if (B == BorderMode::CONSTANT) {
+    if (x < 0 || x >= src.cols || y < 0 || y >= src.rows) {
+      for (int c = 0; c < Cn; c++) {
+        dst[c] = border;
+      }
+      return;
+    }
+  } else {
+    if (x < 0) {
+      x = 0;
+    } else if (x >= src.cols) {
+      x = src.cols - 1;
+    }
+
+    if (y < 0) {
+      y = 0;
+    } else if (y >= src.rows) {
+      y = src.rows - 1;
+    }
+  }
+
+  const T* pixel = src.ptr<T>((int)y) + (int)x * Cn;
+  for (int c = 0; c < Cn; c++) {
+    dst[c] = pixel[c];
+  }
+}
+
+/** Resample the source at one location with bilinear interpolation (the
+ *  per-pixel step of Remap, for a map value of (x, y); source at least
+ *  2 x 2)
+ *
+ *  Bilinear weights are single precision and the result is truncated to an
+ *  integer depth, as for the original CV_8UC3 remap.
+ *
+ *  \param[in] src     source cv::Mat of Cn channels of T
+ *  \param[in] x       horizontal source coordinate
+ *  \param[in] y       vertical source coordinate
+ *  \param[in] border  border value of every channel for the constant border
+ *                     mode
+ *  \param[out] dst    channels of the destination pixel
+ */
+template <typename T, int Cn, BorderMode B>
+inline void RemapPixelLinear(const cv::Mat& src, double x, double y,
+                             const T border, T* dst) {
+  if (B == BorderMode::CONSTANT) {
+    if (x < 0 || x >= src.cols - 1 || y < 0 || y >= src.rows - 1) {
+      for (int c = 0; c < Cn; c++) {
+        dst[c] = border;
+      }
+      return;
+    }
+  } else {
+    if (x < 0) {
+      x = 0;
+    } else if (x >= src.cols - 1) {
+      x = src.cols - 2;
+    }
+
+    if (y < 0) {
+      y = 0;
+    } else if (y >= src.rows - 1) {
+      y = src.rows - 2;
+    }
+  }
+
+  const int x1 = (int)floor(x);
+  const int y1 = (int)floor(y);
+
+  cv::Point2f remainder;
+  remainder.x = x - x1;
+  remainder.y = y - y1;
+
+  const T* top_row = src.ptr<T>(y1) + x1 * Cn;
+  const T* bottom_row = src.ptr<T>(y1 + 1) + x1 * Cn;
+  for (int c = 0; c < Cn; c++) {
+    double top = (1 - remainder.x) * top_row[c] + remainder.x * top_row[c + Cn];
+    double bottom =
+        (1 - remainder.x) * bottom_row[c] + remainder.x * bottom_row[c + Cn];
+    dst[c] = (T)((1 - remainder.y) * top + remainder.y * bottom);
+  }
+}
+}
@@ -0,0 +1,234 @@
+/** Implementation file for composable geometric transformations
+ *
+ *  \file ipcv/geometric_transformation/Transform.cpp
+ *  \author Anthony Guarino (ag4933@rit.edu)
+ *  \date 16 Oct 2026
+ */
+
+#include "Transform.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "MapGCP.h"
+#include "MapQ2Q.h"
+#include "MapRST.h"
+
+using namespace std;
+
+namespace ipcv {
+
+/** Source locations of a run of destination locations, one at a time */
+void Transform::Inverse(const int length, const double* x, const double* y,
+                        double* source_x, double* source_y) const {
+  for (int i = 0; i < length; i++) {
+    Inverse(x[i], y[i], source_x[i], source_y[i]);
+  }
+}
+
+/** \param[in] src_size      size of the source
+ *  \param[in] angle         rotation angle (CCW) [radians]
+ *  \param[in] scale_x       horizontal scale
+ *  \param[in] scale_y       vertical scale
+ *  \param[in] translation_x horizontal translation [+ to the right]
+ *  \param[in] translation_y vertical translation [+ up]
+ */
+RSTTransform::RSTTransform(const cv::Size& src_size, const double angle,
+                           const double scale_x, const double scale_y,
+                           const double translation_x,
+                           const double translation_y) {
+  RSTAffine(src_size, angle, scale_x, scale_y, translation_x, translation_y,
+            affine_, dst_size_);
+
+  // Source location of destination pixel (0, 0)
+  RSTRowStart(affine_, src_size, dst_size_, 0, offset_x_, offset_y_);
+}
+
+void RSTTransform::Inverse(const double x, const double y, double& source_x,
+                           double& source_y) const {
+  source_x = affine_(0, 0) * x + affine_(0, 1) * y + offset_x_;
+  source_y = affine_(1, 0) * x + affine_(1, 1) * y + offset_y_;
+}
+
+void RSTTransform::Inverse(const int length, const double* x, const double* y,
+                           double* source_x, double* source_y) const {
+  const double a00 = affine_(0, 0), a01 = affine_(0, 1);
+  const double a10 = affine_(1, 0), a11 = affine_(1, 1);
+  for (int i = 0; i < length; i++) {
+    const double col = x[i];
+    const double row = y[i];
+    source_x[i] = a00 * col + a01 * row + offset_x_;
+    source_y[i] = a10 * col + a11 * row + offset_y_;
+  }
+}
+
+/** \param[in] src_vertices
+ *                       vertices cv:Point of the source quadrilateral (CW)
+ *  \param[in] tgt_vertices
+ *                       vertices cv:Point of the target quadrilateral (CW)
+ */
+Q2QTransform::Q2QTransform(const vector<cv::Point>& src_vertices,
+                           const vector<cv::Point>& tgt_vertices) {
+  valid_ = Q2QHomography(src_vertices, tgt_vertices, P_);
+}
+
+void Q2QTransform::Inverse(const double x, const double y, double& source_x,
+                           double& source_y) const {
+  const double w = P_(2, 0) * x + P_(2, 1) * y + P_(2, 2);
+  source_x = (P_(0, 0) * x + P_(0, 1) * y + P_(0, 2)) / w;
+  source_y = (P_(1, 0) * x + P_(1, 1) * y + P_(1, 2)) / w;
+}
+
+void Q2QTransform::Inverse(const int length, const double* x, const double* y,
+                           double* source_x, double* source_y) const {
+  const Eigen::Matrix3d P = P_;
+  for (int i = 0; i < length; i++) {
+    const double col = x[i];
+    const double row = y[i];
+    const double w = P(2, 0) * col + P(2, 1) * row + P(2, 2);
+    source_x[i] = (P(0, 0) * col + P(0, 1) * row + P(0, 2)) / w;
+    source_y[i] = (P(1, 0) * col + P(1, 1) * row + P(1, 2)) / w;
+  }
+}
+
+/** \param[in] src_points  ground control points from the source image
+ *  \param[in] map_points  ground control points from the map image
+ *  \param[in] order       mapping polynomial order
+ */
+GCPTransform::GCPTransform(const vector<cv::Point>& src_points,
+                           const vector<cv::Point>& map_points,
+                           const int order)
+    : order_(order) {
+  valid_ = order >= 0 && src_points.size() == map_points.size() &&
+           map_points.size() >=
+               static_cast<size_t>((order + 1) * (order + 2) / 2);
+  if (valid_) {
+    FitGCP(src_points, map_points, order, a_, b_);
+  }
+}
+
+void GCPTransform::Inverse(const double x, const double y, double& source_x,
+                           double& source_y) const {
+  // Horner's rule in x for every power j of y, then in y; term
+  // x^(i - j) * y^j is coefficient i * (i + 1) / 2 + j
+  source_x = 0;
+  source_y = 0;
+  for (int j = order_; j >= 0; j--) {
+    double x_polynomial_a = 0;
+    double x_polynomial_b = 0;
+    for (int i = order_; i >= j; i--) {
+      const int idx = i * (i + 1) / 2 + j;
+      x_polynomial_a = x_polynomial_a * x + a_(idx);
+      x_polynomial_b = x_polynomial_b * x + b_(idx);
+    }
+    source_x = source_x * y + x_polynomial_a;
+    source_y = source_y * y + x_polynomial_b;
+  }
+}
+
+/** Append a transformation, applied to the output of the chain so far */
+TransformChain& TransformChain::Then(
+    const shared_ptr<const Transform>& transform) {
+  transforms_.push_back(transform);
+  return *this;
+}
+
+void TransformChain::Inverse(const double x, const double y, double& source_x,
+                             double& source_y) const {
+  source_x = x;
+  source_y = y;
+  for (auto transform = transforms_.rbegin(); transform != transforms_.rend();
+       ++transform) {
+    (*transform)->Inverse(source_x, source_y, source_x, source_y);
+  }
+}
+
+void TransformChain::Inverse(const int length, const double* x,
+                             const double* y, double* source_x,
+                             double* source_y) const {
+  if (source_x != x) {
+    std::copy(x, x + length, source_x);
+  }
+  if (source_y != y) {
+    std::copy(y, y + length, source_y);
+  }
+  for (auto transform = transforms_.rbegin(); transform != transforms_.rend();
+       ++transform) {
+    (*transform)->Inverse(length, source_x, source_y, source_x, source_y);
+  }
+}
+
+/** False when any transformation of the chain is */
+bool TransformChain::Valid() const {
+  for (const auto& transform : transforms_) {
+    if (!transform || !transform->Valid()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/** Find the source coordinates (map1, map2) of a transformation
+ *
+ *  \param[in] transform  transformation (or chain of them)
+ *  \param[in] dst_size   size of the destination
+ *  \param[out] map1      cv::Mat of CV_32FC1 (dst_size) containing the
+ *                        horizontal (x) coordinates at which to resample the
+ *                        source data
+ *  \param[out] map2      cv::Mat of CV_32FC1 (dst_size) containing the
+ *                        vertical (y) coordinates at which to resample the
+ *                        source data
+ */
+bool MapTransform(const Transform& transform, const cv::Size& dst_size,
+                  cv::Mat& map1, cv::Mat& map2) {
+  if (!transform.Valid() || dst_size.width <= 0 || dst_size.height <= 0) {
+    return false;
+  }
+
+  map1.create(dst_size, CV_32FC1);
+  map2.create(dst_size, CV_32FC1);
+
+  // Take a whole row through the transformation at a time
+  vector<double> x(dst_size.width);
+  vector<double> y(dst_size.width);
+  for (int row = 0; row < dst_size.height; row++) {
+    for (int col = 0; col < dst_size.width; col++) {
+      x[col] = col;
+      y[col] = row;
+    }
+    transform.Inverse(dst_size.width, x.data(), y.data(), x.data(), y.data());
+
+    float* map1_row = map1.ptr<float>(row);
+    float* map2_row = map2.ptr<float>(row);
+    for (int col = 0; col < dst_size.width; col++) {
+      map1_row[col] = static_cast<float>(x[col]);
+      map2_row[col] = static_cast<float>(y[col]);
+    }
+  }
+
+  return true;
+}
+
+/** Resample the source through a transformation (or chain of them) in a
+ *  single Remap pass
+ *
+ *  \param[in] src            source cv::Mat of any type Remap supports
+ *  \param[out] dst           destination cv::Mat of the type of src
+ *                            (dst_size)
+ *  \param[in] transform      transformation (or chain of them)
+ *  \param[in] dst_size       size of the destination
+ *  \param[in] interpolation  interpolation to be used for resampling
+ *  \param[in] border_mode    border mode to be used for out of bounds pixels
+ *  \param[in] border_value   border value (of every channel, saturated to the
+ *                            depth of src) to be used when constant border
+ *                            mode is to be used
+ */
+bool WarpTransform(const cv::Mat& src, cv::Mat& dst, const Transform& transform,
+                   const cv::Size& dst_size, const Interpolation interpolation,
+                   const BorderMode border_mode, const double border_value) {
+  cv::Mat map1;
+  cv::Mat map2;
+  return MapTransform(transform, dst_size, map1, map2) &&
+         Remap(src, dst, map1, map2, interpolation, border_mode, border_value);
+}
+}
@@ -0,0 +1,193 @@
+/** Interface file for composable geometric transformations
+ *
+ *  \file ipcv/geometric_transformation/Transform.h
+ *  \author Anthony Guarino (ag4933@rit.edu)
+ *  \date 16 Oct 2026
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <Eigen/Dense>
+#include <opencv2/core.hpp>
+
+#include "Remap.h"
+
+namespace ipcv {
+
+/** Geometric transformation, described by its point-wise inverse: the
+ *  source location every destination location resamples
+ */
+class Transform {
+ public:
+  virtual ~Transform() {}
+
+  /** Source location of a destination location
+   *
+   *  \param[in] x          horizontal destination coordinate
+   *  \param[in] y          vertical destination coordinate
+   *  \param[out] source_x  horizontal source coordinate
+   *  \param[out] source_y  vertical source coordinate
+   */
+  virtual void Inverse(const double x, const double y, double& source_x,
+                       double& source_y) const = 0;
+
+  /** Source locations of a run of destination locations (the outputs may
+   *  be the inputs)
+   *
+   *  \param[in] length     number of locations
+   *  \param[in] x          horizontal destination coordinates
+   *  \param[in] y          vertical destination coordinates
+   *  \param[out] source_x  horizontal source coordinates
+   *  \param[out] source_y  vertical source coordinates
+   */
+  virtual void Inverse(const int length, const double* x, const double* y,
+                       double* source_x, double* source_y) const;
+
+  /** Whether the transformation could be set up */
+  virtual bool Valid() const { return true; }
+};
+
+/** RST transformation, as MapRST finds it */
+class RSTTransform : public Transform {
+ public:
+  /** \param[in] src_size      size of the source
+   *  \param[in] angle         rotation angle (CCW) [radians]
+   *  \param[in] scale_x       horizontal scale
+   *  \param[in] scale_y       vertical scale
+   *  \param[in] translation_x horizontal translation [+ to the right]
+   *  \param[in] translation_y vertical translation [+ up]
+   */
+  RSTTransform(const cv::Size& src_size, const double angle,
+               const double scale_x, const double scale_y,
+               const double translation_x, const double translation_y);
+
+  using Transform::Inverse;
+  void Inverse(const double x, const double y, double& source_x,
+               double& source_y) const override;
+  void Inverse(const int length, const double* x, const double* y,
+               double* source_x, double* source_y) const override;
+
+  /** Size of the destination MapRST would find */
+  cv::Size DstSize() const { return dst_size_; }
+
+ private:
+  Eigen::Matrix3d affine_;
+  cv::Size dst_size_;
+  double offset_x_;
+  double offset_y_;
+};
+
+/** Quad to quad (perspective) transformation, as MapQ2Q finds it */
+class Q2QTransform : public Transform {
+ public:
+  /** \param[in] src_vertices
+   *                       vertices cv:Point of the source quadrilateral (CW)
+   *  \param[in] tgt_vertices
+   *                       vertices cv:Point of the target quadrilateral (CW)
+   */
+  Q2QTransform(const std::vector<cv::Point>& src_vertices,
+               const std::vector<cv::Point>& tgt_vertices);
+
+  using Transform::Inverse;
+  void Inverse(const double x, const double y, double& source_x,
+               double& source_y) const override;
+  void Inverse(const int length, const double* x, const double* y,
+               double* source_x, double* source_y) const override;
+
+  /** False when the quadrilaterals are degenerate */
+  bool Valid() const override { return valid_; }
+
+ private:
+  Eigen::Matrix3d P_;
+  bool valid_;
+};
+
+/** Ground control point derived mapping polynomial transformation, as
+ *  MapGCP finds it
+ */
+class GCPTransform : public Transform {
+ public:
+  /** \param[in] src_points  ground control points from the source image
+   *  \param[in] map_points  ground control points from the map image
+   *  \param[in] order       mapping polynomial order
+   */
+  GCPTransform(const std::vector<cv::Point>& src_points,
+               const std::vector<cv::Point>& map_points, const int order);
+
+  using Transform::Inverse;
+  void Inverse(const double x, const double y, double& source_x,
+               double& source_y) const override;
+
+  /** False without a point for every polynomial term */
+  bool Valid() const override { return valid_; }
+
+ private:
+  Eigen::VectorXd a_;
+  Eigen::VectorXd b_;
+  int order_;
+  bool valid_;
+};
+
+/** Transformations applied one after the other, each to the output of the
+ *  one before
+ *
+ *  A destination location goes through the inverses of the last
+ *  transformation to the first, so the chain resamples the source once.
+ *  Unlike a resample per transformation, nothing is lost where an
+ *  intermediate image would have ended.
+ */
+class TransformChain : public Transform {
+ public:
+  /** Append a transformation, applied to the output of the chain so far */
+  TransformChain& Then(const std::shared_ptr<const Transform>& transform);
+
+  using Transform::Inverse;
+  void Inverse(const double x, const double y, double& source_x,
+               double& source_y) const override;
+  void Inverse(const int length, const double* x, const double* y,
+               double* source_x, double* source_y) const override;
+
+  /** False when any transformation of the chain is */
+  bool Valid() const override;
+
+ private:
+  std::vector<std::shared_ptr<const Transform>> transforms_;
+};
+
+/** Find the source coordinates (map1, map2) of a transformation
+ *
+ *  \param[in] transform  transformation (or chain of them)
+ *  \param[in] dst_size   size of the destination
+ *  \param[out] map1      cv::Mat of CV_32FC1 (dst_size) containing the
+ *                        horizontal (x) coordinates at which to resample the
+ *                        source data
+ *  \param[out] map2      cv::Mat of CV_32FC1 (dst_size) containing the
+ *                        vertical (y) coordinates at which to resample the
+ *                        source data
+ */
+bool MapTransform(const Transform& transform, const cv::Size& dst_size,
+                  cv::Mat& map1, cv::Mat& map2);
+
+/** Resample the source through a transformation (or chain of them) in a
+ *  single Remap pass
+ *
+ *  \param[in] src            source cv::Mat of any type Remap supports
+ *  \param[out] dst           destination cv::Mat of the type of src
+ *                            (dst_size)
+ *  \param[in] transform      transformation (or chain of them)
+ *  \param[in] dst_size       size of the destination
+ *  \param[in] interpolation  interpolation to be used for resampling
+ *  \param[in] border_mode    border mode to be used for out of bounds pixels
+ *  \param[in] border_value   border value (of every channel, saturated to the
+ *                            depth of src) to be used when constant border
+ *                            mode is to be used
+ */
+bool WarpTransform(const cv::Mat& src, cv::Mat& dst, const Transform& transform,
+                   const cv::Size& dst_size,
+                   const Interpolation interpolation = Interpolation::NEAREST,
+                   const BorderMode border_mode = BorderMode::CONSTANT,
+                   const double border_value = 0);
+}
@@ -0,0 +1,275 @@
+/** Implementation file for warping a source quad onto a target quad without
+ *  a map
+ *
+ *  \file ipcv/geometric_transformation/WarpQ2Q.cpp
+ *  \author Anthony Guarino (ag4933@rit.edu)
+ *  \date 16 Oct 2026
+ */
+
+#include "WarpQ2Q.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include "MapQ2Q.h"
+#include "RemapFixed.h"
+#include "imgs/ipcv/parallel/TileExecutor.h"
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#define IPCV_WARP_X86 1
+#include <immintrin.h>
+#endif
+
+using namespace std;
+
+namespace ipcv {
+
+// Columns kept beyond each end of the span of a row found to fall inside the
+// source, covering the rounding of its ends
+static const int kSpanMargin = 2;
+
+// Target rows warped by one task of the tile executor
+static const int kRowsPerTask = 16;
+
+/** Row buffers of one worker */
+struct WarpQ2QScratch {
+  vector<float> x;
+  vector<float> y;
+  vector<int16_t> xy;
+  vector<uint16_t> fraction;
+};
+
+/** Keep the columns c of [first, last] where slope * c + offset >= 0 */
+static void ClipSpan(const double slope, const double offset, double& first,
+                     double& last) {
+  if (slope == 0) {
+    if (offset < 0) {
+      last = first - 1;
+    }
+    return;
+  }
+
+  const double root = -offset / slope;
+  if (slope > 0) {
+    first = std::max(first, root);
+  } else {
+    last = std::min(last, root);
+  }
+}
+
+/** Find the columns of a target row whose source locations can fall in
+ *  [0, width] x [0, height]
+ *
+ *  Along a row the numerators and the denominator are linear in the
+ *  column, so while the denominator keeps its sign every bound is a linear
+ *  inequality in the column and the span is their intersection.
+ *
+ *  \param[in] P       target to source perspective transformation matrix
+ *  \param[in] row     target row
+ *  \param[in] cols    target columns
+ *  \param[in] width   largest horizontal source coordinate sampled
+ *  \param[in] height  largest vertical source coordinate sampled
+ *  \param[out] first  first column of the span
+ *  \param[out] last   last column of the span
+ *
+ *  \return false when no column of the row falls inside
+ */
+static bool InsideSpan(const Eigen::Matrix3d& P, const int row, const int cols,
+                       const double width, const double height, int& first,
+                       int& last) {
+  const double x_offset = P(0, 1) * row + P(0, 2);
+  const double y_offset = P(1, 1) * row + P(1, 2);
+  const double w_offset = P(2, 1) * row + P(2, 2);
+
+  // The horizon crosses the row, so the span may be split in two
+  const double w_first = w_offset;
+  const double w_last = P(2, 0) * (cols - 1) + w_offset;
+  if (!(w_first > 0 && w_last > 0) && !(w_first < 0 && w_last < 0)) {
+    first = 0;
+    last = cols - 1;
+    return true;
+  }
+
+  // 0 <= x / w <= width becomes sign * x >= 0 and sign * (width w - x) >= 0
+  const double sign = (w_first > 0) ? 1 : -1;
+  double span_first = 0;
+  double span_last = cols - 1;
+  ClipSpan(sign * P(0, 0), sign * x_offset, span_first, span_last);
+  ClipSpan(sign * (width * P(2, 0) - P(0, 0)),
+           sign * (width * w_offset - x_offset), span_first, span_last);
+  ClipSpan(sign * P(1, 0), sign * y_offset, span_first, span_last);
+  ClipSpan(sign * (height * P(2, 0) - P(1, 0)),
+           sign * (height * w_offset - y_offset), span_first, span_last);
+  if (!(span_first <= span_last)) {
+    return false;
+  }
+
+  first = std::max(0, static_cast<int>(std::floor(span_first)) - kSpanMargin);
+  last = std::min(cols - 1,
+                  static_cast<int>(std::ceil(span_last)) + kSpanMargin);
+  return true;
+}
+
+#if IPCV_WARP_X86
+/** AVX2 source locations of a span of a target row, four columns per
+ *  iteration
+ *
+ *  \return number of locations found (a multiple of four)
+ */
+__attribute__((target("avx2"))) static int RowLocationsAvx2(
+    const Eigen::Matrix3d& P, const int row, const int first,
+    const int length, float* x, float* y) {
+  const __m256d columns =
+      _mm256_add_pd(_mm256_set1_pd(first), _mm256_setr_pd(0, 1, 2, 3));
+  __m256d x_numerator = _mm256_add_pd(
+      _mm256_mul_pd(_mm256_set1_pd(P(0, 0)), columns),
+      _mm256_set1_pd(P(0, 1) * row + P(0, 2)));
+  __m256d y_numerator = _mm256_add_pd(
+      _mm256_mul_pd(_mm256_set1_pd(P(1, 0)), columns),
+      _mm256_set1_pd(P(1, 1) * row + P(1, 2)));
+  __m256d denominator = _mm256_add_pd(
+      _mm256_mul_pd(_mm256_set1_pd(P(2, 0)), columns),
+      _mm256_set1_pd(P(2, 1) * row + P(2, 2)));
+  const __m256d x_step = _mm256_set1_pd(4 * P(0, 0));
+  const __m256d y_step = _mm256_set1_pd(4 * P(1, 0));
+  const __m256d w_step = _mm256_set1_pd(4 * P(2, 0));
+
+  int j = 0;
+  for (; j + 4 <= length; j += 4) {
+    _mm_storeu_ps(x + j,
+                  _mm256_cvtpd_ps(_mm256_div_pd(x_numerator, denominator)));
+    _mm_storeu_ps(y + j,
+                  _mm256_cvtpd_ps(_mm256_div_pd(y_numerator, denominator)));
+    x_numerator = _mm256_add_pd(x_numerator, x_step);
+    y_numerator = _mm256_add_pd(y_numerator, y_step);
+    denominator = _mm256_add_pd(denominator, w_step);
+  }
+
+  return j;
+}
+#endif
+
+/** Source locations of a span of a target row
+ *
+ *  \param[in] P       target to source perspective transformation matrix
+ *  \param[in] row     target row
+ *  \param[in] first   first column of the span
+ *  \param[in] length  columns in the span
+ *  \param[out] x      horizontal source coordinates
+ *  \param[out] y      vertical source coordinates
+ */
+static void RowLocations(const Eigen::Matrix3d& P, const int row,
+                         const int first, const int length, float* x,
+                         float* y) {
+  int done = 0;
+#if IPCV_WARP_X86
+  static const bool avx2 = __builtin_cpu_supports("avx2");
+  if (avx2) {
+    done = RowLocationsAvx2(P, row, first, length, x, y);
+  }
+#endif
+
+  const double column = first + done;
+  double x_numerator = P(0, 0) * column + P(0, 1) * row + P(0, 2);
+  double y_numerator = P(1, 0) * column + P(1, 1) * row + P(1, 2);
+  double denominator = P(2, 0) * column + P(2, 1) * row + P(2, 2);
+  for (int j = done; j < length; j++) {
+    x[j] = static_cast<float>(x_numerator / denominator);
+    y[j] = static_cast<float>(y_numerator / denominator);
+    x_numerator += P(0, 0);
+    y_numerator += P(1, 0);
+    denominator += P(2, 0);
+  }
+}
+
+/** Warp a source quad onto a target quad, resampling the source directly
+ *
+ *  \param[in] src            source cv::Mat of CV_8UC1, CV_8UC3 or CV_8UC4
+ *  \param[out] dst           destination cv::Mat of the type of src
+ *  \param[in] dst_size       size of the destination (the target image)
+ *  \param[in] src_vertices   vertices cv::Point of the source quadrilateral
+ *                            (CW)
+ *  \param[in] tgt_vertices   vertices cv::Point of the target quadrilateral
+ *                            (CW)
+ *  \param[in] interpolation  interpolation to be used for resampling (nearest
+ *                            neighbor or bilinear)
+ *  \param[in] border_mode    border mode to be used for out-of-bounds pixels
+ *  \param[in] border_value   border value to be used when constant border mode
+ *                            is to be used
+ */
+bool WarpQ2Q(const cv::Mat& src, cv::Mat& dst, const cv::Size& dst_size,
+             const vector<cv::Point>& src_vertices,
+             const vector<cv::Point>& tgt_vertices,
+             const Interpolation interpolation, const BorderMode border_mode,
+             const uint8_t border_value) {
+  const int cn = src.channels();
+  const bool linear = (interpolation == Interpolation::LINEAR);
+  if (src.empty() || src.depth() != CV_8U || (cn != 1 && cn != 3 && cn != 4) ||
+      src.cols > INT16_MAX || src.rows > INT16_MAX ||
+      (interpolation != Interpolation::NEAREST && !linear) ||
+      (linear && (src.cols < 2 || src.rows < 2)) || dst_size.width <= 0 ||
+      dst_size.height <= 0) {
+    return false;
+  }
+
+  Eigen::Matrix3d P;
+  if (!Q2QHomography(src_vertices, tgt_vertices, P)) {
+    return false;
+  }
+
+  const cv::Mat source = (src.data == dst.data) ? src.clone() : src;
+  dst.create(dst_size, source.type());
+
+  // Largest coordinates sampled inside the source
+  const double width = linear ? source.cols - 1 : source.cols;
+  const double height = linear ? source.rows - 1 : source.rows;
+
+  // Rows are independent: blocks of them run in parallel, each worker
+  // computing one row of locations at a time in its own buffers
+  const int cols = dst_size.width;
+  TileExecutor& executor = SharedTileExecutor();
+  vector<WarpQ2QScratch> scratches(executor.Threads());
+  const int blocks = (dst_size.height + kRowsPerTask - 1) / kRowsPerTask;
+
+  executor.Run(blocks, [&](int block, int worker) {
+    WarpQ2QScratch& scratch = scratches[worker];
+    if (scratch.x.empty()) {
+      scratch.x.resize(cols);
+      scratch.y.resize(cols);
+      scratch.xy.resize(2 * cols);
+      scratch.fraction.resize(linear ? cols : 0);
+    }
+
+    const int end_row = std::min((block + 1) * kRowsPerTask, dst_size.height);
+    for (int row = block * kRowsPerTask; row < end_row; row++) {
+      uint8_t* dst_row = dst.ptr<uint8_t>(row);
+
+      int first = 0;
+      int last = cols - 1;
+      if (border_mode == BorderMode::CONSTANT) {
+        if (!InsideSpan(P, row, cols, width, height, first, last)) {
+          std::memset(dst_row, border_value, static_cast<size_t>(cols) * cn);
+          continue;
+        }
+        std::memset(dst_row, border_value, static_cast<size_t>(first) * cn);
+        std::memset(dst_row + (last + 1) * cn, border_value,
+                    static_cast<size_t>(cols - 1 - last) * cn);
+      }
+
+      const int length = last - first + 1;
+      uint16_t* row_fraction = linear ? scratch.fraction.data() : nullptr;
+      RowLocations(P, row, first, length, scratch.x.data(), scratch.y.data());
+      ConvertRowFixed(scratch.x.data(), scratch.y.data(), length,
+                      scratch.xy.data(), row_fraction);
+      RemapFixedRow(source, scratch.xy.data(), row_fraction, length,
+                    border_mode, border_value, dst_row + first * cn);
+    }
+  });
+
+  return true;
+}
+}
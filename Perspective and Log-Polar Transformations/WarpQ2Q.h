@@ -0,0 +1,50 @@
+/** Interface file for warping a source quad onto a target quad without a
+ *  map
+ *
+ *  \file ipcv/geometric_transformation/WarpQ2Q.h
+ *  \author Anthony Guarino (ag4933@rit.edu)
+ *  \date 16 Oct 2026
+ */
+
+#pragma once
+
+#include <vector>
+
+#include <opencv2/core.hpp>
+
+#include "Remap.h"
+
+namespace ipcv {
+
+/** Warp a source quad onto a target quad, resampling the source directly
+ *
+ *  The homography numerators and denominator are stepped along each target
+ *  row (four columns at a time with AVX2) and the locations resampled as
+ *  RemapFixed does, a row at a time, so no map is ever stored.  For the
+ *  constant border mode only the span of each row whose locations can fall
+ *  inside the source is resampled; the rest of the row, and rows without
+ *  such a span, are set to the border value.
+ *
+ *  \param[in] src            source cv::Mat of CV_8UC1, CV_8UC3 or CV_8UC4
+ *                            (at most 32767 x 32767)
+ *  \param[out] dst           destination cv::Mat of the type of src
+ *  \param[in] dst_size       size of the destination (the target image)
+ *  \param[in] src_vertices   vertices cv::Point of the source quadrilateral
+ *                            (CW) which is to be mapped to the target
+ *                            quadrilateral
+ *  \param[in] tgt_vertices   vertices cv::Point of the target quadrilateral
+ *                            (CW) into which the source quadrilateral is to
+ *                            be mapped
+ *  \param[in] interpolation  interpolation to be used for resampling (nearest
+ *                            neighbor or bilinear)
+ *  \param[in] border_mode    border mode to be used for out of bounds pixels
+ *  \param[in] border_value   border value to be used when constant border mode
+ *                            is to be used
+ */
+bool WarpQ2Q(const cv::Mat& src, cv::Mat& dst, const cv::Size& dst_size,
+             const std::vector<cv::Point>& src_vertices,
+             const std::vector<cv::Point>& tgt_vertices,
+             const Interpolation interpolation = Interpolation::NEAREST,
+             const BorderMode border_mode = BorderMode::CONSTANT,
+             const uint8_t border_value = 0);
+}
@@ -0,0 +1,167 @@
+/** Implementation file for warping a source image by an RST transformation
+ *  without a map
+ *
+ *  \file ipcv/geometric_transformation/WarpRST.cpp
+ *  \author Anthony Guarino (ag4933@rit.edu)
+ *  \date 16 Oct 2026
+ */
+
+#include "WarpRST.h"
+
+#include <cstdint>
+
+#include <Eigen/Dense>
+
+#include "MapRST.h"
+#include "RemapPixel.h"
+
+using namespace std;
+
+namespace ipcv {
+
+/** Warp the destination rows with one inner loop per source type,
+ *  interpolation and border mode
+ *
+ *  \param[in] src     source cv::Mat of Cn channels of T
+ *  \param[out] dst    destination cv::Mat (allocated)
+ *  \param[in] affine  affine matrix of the transformation (see RSTAffine)
+ *  \param[in] border  border value of every channel
+ */
+template <typename T, int Cn, Interpolation I, BorderMode B>
+static void WarpRSTLoop(const cv::Mat& src, cv::Mat& dst,
+                        const Eigen::Matrix3d& affine, const T border) {
+  const double step_x = affine(0, 0);
+  const double step_y = affine(1, 0);
+
+  for (int row = 0; row < dst.rows; row++) {
+    double x, y;
+    RSTRowStart(affine, src.size(), dst.size(), row, x, y);
+
+    // The locations are rounded to float as MapRST stores them
+    T* dst_pixel = dst.ptr<T>(row);
+    for (int col = 0; col < dst.cols; col++, dst_pixel += Cn) {
+      if (I == Interpolation::NEAREST) {
+        RemapPixelNearest<T, Cn, B>(src, static_cast<float>(x),
+                                    static_cast<float>(y), border, dst_pixel);
+      } else {
+        RemapPixelLinear<T, Cn, B>(src, static_cast<float>(x),
+                                   static_cast<float>(y), border, dst_pixel);
+      }
+      x += step_x;
+      y += step_y;
+    }
+  }
+}
+
+/** Warp a source of Cn channels of T, choosing the loop for the
+ *  interpolation and border mode
+ */
+template <typename T, int Cn>
+static void WarpRSTChannels(const cv::Mat& src, cv::Mat& dst,
+                            const Eigen::Matrix3d& affine,
+                            const Interpolation interpolation,
+                            const BorderMode border_mode, const T border) {
+  const bool constant = (border_mode == BorderMode::CONSTANT);
+  if (interpolation == Interpolation::LINEAR) {
+    if (constant) {
+      WarpRSTLoop<T, Cn, Interpolation::LINEAR, BorderMode::CONSTANT>(
+          src, dst, affine, border);
+    } else {
+      WarpRSTLoop<T, Cn, Interpolation::LINEAR, BorderMode::REPLICATE>(
+          src, dst, affine, border);
+    }
+  } else {
+    if (constant) {
+      WarpRSTLoop<T, Cn, Interpolation::NEAREST, BorderMode::CONSTANT>(
+          src, dst, affine, border);
+    } else {
+      WarpRSTLoop<T, Cn, Interpolation::NEAREST, BorderMode::REPLICATE>(
+          src, dst, affine, border);
+    }
+  }
+}
+
+/** Warp a source of T, choosing the loop for the number of channels */
+template <typename T>
+static void WarpRSTDepth(const cv::Mat& src, cv::Mat& dst,
+                         const Eigen::Matrix3d& affine,
+                         const Interpolation interpolation,
+                         const BorderMode border_mode,
+                         const double border_value) {
+  const T border = cv::saturate_cast<T>(border_value);
+
+  switch (src.channels()) {
+    case 1:
+      WarpRSTChannels<T, 1>(src, dst, affine, interpolation, border_mode,
+                            border);
+      break;
+    case 3:
+      WarpRSTChannels<T, 3>(src, dst, affine, interpolation, border_mode,
+                            border);
+      break;
+    default:
+      WarpRSTChannels<T, 4>(src, dst, affine, interpolation, border_mode,
+                            border);
+      break;
+  }
+}
+
+/** Warp the source by an RST transformation, resampling it directly
+ *
+ *  \param[in] src            source cv::Mat of CV_8U, CV_16U or CV_32F with 1,
+ *                            3 or 4 channels
+ *  \param[out] dst           destination cv::Mat of the type of src (size
+ *                            of the transformed source)
+ *  \param[in] angle          rotation angle (CCW) [radians]
+ *  \param[in] scale_x        horizontal scale
+ *  \param[in] scale_y        vertical scale
+ *  \param[in] translation_x  horizontal translation [+ right]
+ *  \param[in] translation_y  vertical translation [+ up]
+ *  \param[in] interpolation  interpolation to be used for resampling (nearest
+ *                            neighbor or bilinear)
+ *  \param[in] border_mode    border mode to be used for out-of-bounds pixels
+ *  \param[in] border_value   border value (of every channel, saturated to the
+ *                            depth of src) to be used when constant border
+ *                            mode is to be used
+ */
+bool WarpRST(const cv::Mat& src, cv::Mat& dst, const double angle,
+             const double scale_x, const double scale_y,
+             const double translation_x, const double translation_y,
+             const Interpolation interpolation, const BorderMode border_mode,
+             const double border_value) {
+  const bool linear = (interpolation == Interpolation::LINEAR);
+  const int depth = src.depth();
+  const int cn = src.channels();
+  if (src.empty() || (depth != CV_8U && depth != CV_16U && depth != CV_32F) ||
+      (cn != 1 && cn != 3 && cn != 4) ||
+      (interpolation != Interpolation::NEAREST && !linear) ||
+      (linear && (src.cols < 2 || src.rows < 2))) {
+    return false;
+  }
+
+  Eigen::Matrix3d affine;
+  cv::Size size;
+  RSTAffine(src.size(), angle, scale_x, scale_y, translation_x, translation_y,
+            affine, size);
+
+  const cv::Mat source = (src.data == dst.data) ? src.clone() : src;
+  dst.create(size, source.type());
+
+  switch (depth) {
+    case CV_8U:
+      WarpRSTDepth<uint8_t>(source, dst, affine, interpolation, border_mode,
+                            border_value);
+      break;
+    case CV_16U:
+      WarpRSTDepth<uint16_t>(source, dst, affine, interpolation, border_mode,
+                             border_value);
+      break;
+    default:
+      WarpRSTDepth<float>(source, dst, affine, interpolation, border_mode,
+                          border_value);
+      break;
+  }
+
+  return true;
+}
+}
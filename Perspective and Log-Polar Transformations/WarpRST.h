@@ -0,0 +1,46 @@
+/** Interface file for warping a source image by an RST transformation
+ *  without a map
+ *
+ *  \file ipcv/geometric_transformation/WarpRST.h
+ *  \author Anthony Guarino (ag4933@rit.edu)
+ *  \date 16 Oct 2026
+ */
+
+#pragma once
+
+#include <opencv2/core.hpp>
+
+#include "Remap.h"
+
+namespace ipcv {
+
+/** Warp the source by an RST transformation, resampling it directly
+ *
+ *  The source location of every destination pixel is stepped along each
+ *  row from the location of its first pixel, exactly as MapRST fills its
+ *  maps, and resampled as Remap does, so the result is identical to MapRST
+ *  followed by Remap without the 8 bytes of map per destination pixel.
+ *
+ *  \param[in] src            source cv::Mat of CV_8U, CV_16U or CV_32F with 1,
+ *                            3 or 4 channels
+ *  \param[out] dst           destination cv::Mat of the type of src (size
+ *                            of the transformed source)
+ *  \param[in] angle          rotation angle (CCW) [radians]
+ *  \param[in] scale_x        horizontal scale
+ *  \param[in] scale_y        vertical scale
+ *  \param[in] translation_x  horizontal translation [+ to the right]
+ *  \param[in] translation_y  vertical translation [+ up]
+ *  \param[in] interpolation  interpolation to be used for resampling (nearest
+ *                            neighbor or bilinear)
+ *  \param[in] border_mode    border mode to be used for out of bounds pixels
+ *  \param[in] border_value   border value (of every channel, saturated to the
+ *                            depth of src) to be used when constant border
+ *                            mode is to be used
+ */
+bool WarpRST(const cv::Mat& src, cv::Mat& dst, const double angle,
+             const double scale_x, const double scale_y,
+             const double translation_x, const double translation_y,
+             const Interpolation interpolation = Interpolation::NEAREST,
+             const BorderMode border_mode = BorderMode::CONSTANT,
+             const double border_value = 0);
+}
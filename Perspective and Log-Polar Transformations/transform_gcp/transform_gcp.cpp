@@ -20,8 +20,11 @@ int main(int argc, char* argv[]) {
   string map_filename = "";
   string gcp_filename = "";
   string dst_filename = "";
+  string map_cache = "";
   int order = 1;
   int value = 0;
+  bool fixed_point = false;
+  ipcv::GCPGrid grid;
 
   string interpolation_string = "nearest";
   ipcv::Interpolation interpolation;
@@ -40,10 +43,20 @@ int main(int argc, char* argv[]) {
       "polynomial-order,n", po::value<int>(&order),
       "order of mapping polynomial [default is 1]")(
       "interpolation,t", po::value<string>(&interpolation_string),
-      "interpolation (nearest|bilinear) [default is nearest]")(
+      "interpolation (nearest|bilinear|bicubic|lanczos3) "
+      "[default is nearest]")(
       "border-mode,m", po::value<string>(&border_mode_string),
       "border mode (constant|replicate) [default is constant]")(
-      "border-value,b", po::value<int>(&value), "border value [default is 0]");
+      "border-value,b", po::value<int>(&value), "border value [default is 0]")(
+      "fixed-point,x", po::bool_switch(&fixed_point),
+      "remap through fixed-point maps [default is floating point]")(
+      "grid-step,s", po::value<int>(&grid.step),
+      "pixels between exactly evaluated map locations [default is 1]")(
+      "max-error,e", po::value<double>(&grid.max_error),
+      "largest map coordinate error allowed for grid steps above 1 "
+      "[default is 0.1]")(
+      "map-cache,c", po::value<string>(&map_cache),
+      "directory of cached maps [default is no cache]");
 
   po::positional_options_description positional_options;
   positional_options.add("source-filename", 1);
@@ -72,12 +85,30 @@ int main(int argc, char* argv[]) {
     interpolation = ipcv::Interpolation::NEAREST;
   } else if (interpolation_string == "bilinear") {
     interpolation = ipcv::Interpolation::LINEAR;
+  } else if (interpolation_string == "bicubic") {
+    interpolation = ipcv::Interpolation::BICUBIC;
+  } else if (interpolation_string == "lanczos3") {
+    interpolation = ipcv::Interpolation::LANCZOS3;
   } else {
     cerr << "*** ERROR *** ";
     cerr << "Provided interpolation is not supported" << endl;
     return EXIT_FAILURE;
   }
 
+  if (grid.step < 1 || grid.max_error < 0) {
+    cerr << "*** ERROR *** ";
+    cerr << "Provided grid step or maximum error is not supported" << endl;
+    return EXIT_FAILURE;
+  }
+
+  if ((fixed_point) && interpolation != ipcv::Interpolation::NEAREST &&
+      interpolation != ipcv::Interpolation::LINEAR) {
+    cerr << "*** ERROR *** ";
+    cerr << "Fixed-point remapping supports nearest and bilinear "
+         << "interpolation only" << endl;
+    return EXIT_FAILURE;
+  }
+
   if (border_mode_string == "constant") {
     border_mode = ipcv::BorderMode::CONSTANT;
   } else if (border_mode_string == "replicate") {
@@ -106,7 +137,15 @@ int main(int argc, char* argv[]) {
     return EXIT_FAILURE;
   }
 
-  cv::Mat src = cv::imread(src_filename, cv::IMREAD_COLOR);
+  if (!map_cache.empty() && !boost::filesystem::exists(map_cache) &&
+      !boost::filesystem::create_directories(map_cache)) {
+    cerr << "*** ERROR *** ";
+    cerr << "Provided map cache directory could not be created" << endl;
+    return EXIT_FAILURE;
+  }
+
+  cv::Mat src =
+      cv::imread(src_filename, cv::IMREAD_ANYDEPTH | cv::IMREAD_ANYCOLOR);
   cv::Mat map = cv::imread(map_filename, cv::IMREAD_COLOR);
 
   if (verbose) {
@@ -121,9 +160,26 @@ int main(int argc, char* argv[]) {
     cout << "Interpolation: " << interpolation_string << endl;
     cout << "Border mode: " << border_mode_string << endl;
     cout << "Border value: " << value << endl;
+    cout << "Fixed point: " << (fixed_point ? "yes" : "no") << endl;
+    cout << "Grid step: " << grid.step << endl;
+    cout << "Maximum error: " << grid.max_error << " [pixels]" << endl;
+    cout << "Map cache: " << map_cache << endl;
     cout << "Destination filename: " << dst_filename << endl;
   }
 
+  if (fixed_point && src.depth() != CV_8U) {
+    cerr << "*** ERROR *** ";
+    cerr << "Fixed-point remapping supports 8-bit sources only" << endl;
+    return EXIT_FAILURE;
+  }
+
+  if (fixed_point && (value < 0 || value > 255)) {
+    cerr << "*** ERROR *** ";
+    cerr << "Provided border value must be in the range [0, 255] for "
+         << "fixed-point remapping" << endl;
+    return EXIT_FAILURE;
+  }
+
   uint8_t border_value = value;
 
   vector<float> sc;
@@ -173,27 +229,56 @@ int main(int argc, char* argv[]) {
   bool status = false;
   cv::Mat map1;
   cv::Mat map2;
-  status = ipcv::MapGCP(src, map, src_points, map_points, order, map1, map2);
+  ipcv::MapCache cache(map_cache);
+  const ipcv::MapCacheKey key =
+      ipcv::MapGCPCacheKey(map.size(), src_points, map_points, order, grid);
+  const bool cached = !map_cache.empty() && cache.Load(key, map1, map2);
+  if (cached) {
+    status = true;
+  } else {
+    status = ipcv::MapGCP(src, map, src_points, map_points, order, map1, map2,
+                          grid);
+    if (status && !map_cache.empty() && !cache.Store(key, map1, map2)) {
+      cerr << "*** WARNING *** ";
+      cerr << "Maps could not be stored in the map cache" << endl;
+    }
+  }
 
   cv::Mat dst;
 //  cv::remap(src, dst, map1, map2, cv::INTER_NEAREST, cv::BORDER_CONSTANT,
 //            cv::Scalar(0, 0, 0) );
-  status = ipcv::Remap(src, dst, map1, map2, interpolation, border_mode,
-                       border_value);
+  if (fixed_point) {
+    cv::Mat xy;
+    cv::Mat fraction;
+    status = ipcv::ConvertMapsFixed(map1, map2, xy, fraction, interpolation) &&
+             ipcv::RemapFixed(src, dst, xy, fraction, interpolation,
+                              border_mode, border_value);
+  } else {
+    status = ipcv::Remap(src, dst, map1, map2, interpolation, border_mode,
+                         value);
+  }
 
   clock_t endTime = clock();
 
   if (verbose) {
+    if (cached) {
+      cout << "Maps loaded from: " << cache.Path(key) << endl;
+    } else {
+      cout << "Grid step used: " << grid.used_step << endl;
+      cout << "Map coordinate error: " << grid.error << " [pixels]" << endl;
+    }
     cout << "Elapsed time: "
          << (endTime - startTime) / static_cast<double>(CLOCKS_PER_SEC)
          << " [s]" << endl;
   }
 
-  cv::Mat overlay;
-  cv::addWeighted(map, 0.5, dst, 0.5, 0.0, overlay, map.depth());
-
   if (status) {
     if (dst_filename.empty()) {
+      cv::Mat dst_8u;
+      ipcv::ConvertTo8U(dst, map.type(), dst_8u);
+      cv::Mat overlay;
+      cv::addWeighted(map, 0.5, dst_8u, 0.5, 0.0, overlay, map.depth());
+
       cv::imshow(src_filename, src);
       cv::imshow(map_filename, map);
       cv::imshow(src_filename + " [Remapped]", dst);
@@ -1,4 +1,4 @@
-#include <ctime>
+#include <chrono>
 #include <iostream>
 
 #include <boost/filesystem.hpp>
@@ -28,6 +28,8 @@ int main(int argc, char* argv[]) {
   string tgt_filename = "";
   string dst_filename = "";
   int value = 0;
+  bool fixed_point = false;
+  bool warp = false;
 
   string interpolation_string = "nearest";
   ipcv::Interpolation interpolation;
@@ -43,10 +45,16 @@ int main(int argc, char* argv[]) {
       "destination-filename,o", po::value<string>(&dst_filename),
       "destination filename [default is empty]")(
       "interpolation,t", po::value<string>(&interpolation_string),
-      "interpolation (nearest|bilinear) [default is nearest]")(
+      "interpolation (nearest|bilinear|bicubic|lanczos3) "
+      "[default is nearest]")(
       "border-mode,m", po::value<string>(&border_mode_string),
       "border mode (constant|replicate) [default is constant]")(
-      "border-value,b", po::value<int>(&value), "border value [default is 0]");
+      "border-value,b", po::value<int>(&value), "border value [default is 0]")(
+      "fixed-point,x", po::bool_switch(&fixed_point),
+      "remap through fixed-point maps [default is floating point]")(
+      "warp,w", po::bool_switch(&warp),
+      "warp directly without maps, resampling as --fixed-point does "
+      "[default is to build maps]");
 
   po::positional_options_description positional_options;
   positional_options.add("source-filename", 1);
@@ -71,12 +79,24 @@ int main(int argc, char* argv[]) {
     interpolation = ipcv::Interpolation::NEAREST;
   } else if (interpolation_string == "bilinear") {
     interpolation = ipcv::Interpolation::LINEAR;
+  } else if (interpolation_string == "bicubic") {
+    interpolation = ipcv::Interpolation::BICUBIC;
+  } else if (interpolation_string == "lanczos3") {
+    interpolation = ipcv::Interpolation::LANCZOS3;
   } else {
     cerr << "*** ERROR *** ";
     cerr << "Provided interpolation is not supported" << endl;
     return EXIT_FAILURE;
   }
 
+  if ((fixed_point || warp) && interpolation != ipcv::Interpolation::NEAREST &&
+      interpolation != ipcv::Interpolation::LINEAR) {
+    cerr << "*** ERROR *** ";
+    cerr << "Fixed-point remapping and warping support nearest and bilinear "
+         << "interpolation only" << endl;
+    return EXIT_FAILURE;
+  }
+
   if (border_mode_string == "constant") {
     border_mode = ipcv::BorderMode::CONSTANT;
   } else if (border_mode_string == "replicate") {
@@ -99,7 +119,8 @@ int main(int argc, char* argv[]) {
     return EXIT_FAILURE;
   }
 
-  cv::Mat src = cv::imread(src_filename, cv::IMREAD_COLOR);
+  cv::Mat src =
+      cv::imread(src_filename, cv::IMREAD_ANYDEPTH | cv::IMREAD_ANYCOLOR);
   cv::Mat tgt = cv::imread(tgt_filename, cv::IMREAD_COLOR);
 
   if (verbose) {
@@ -112,9 +133,25 @@ int main(int argc, char* argv[]) {
     cout << "Interpolation: " << interpolation_string << endl;
     cout << "Border mode: " << border_mode_string << endl;
     cout << "Border value: " << value << endl;
+    cout << "Fixed point: " << (fixed_point ? "yes" : "no") << endl;
+    cout << "Warp: " << (warp ? "yes" : "no") << endl;
     cout << "Destination filename: " << dst_filename << endl;
   }
 
+  if ((fixed_point || warp) && src.depth() != CV_8U) {
+    cerr << "*** ERROR *** ";
+    cerr << "Fixed-point remapping and warping support 8-bit sources only"
+         << endl;
+    return EXIT_FAILURE;
+  }
+
+  if ((fixed_point || warp) && (value < 0 || value > 255)) {
+    cerr << "*** ERROR *** ";
+    cerr << "Provided border value must be in the range [0, 255] for "
+         << "fixed-point remapping and warping" << endl;
+    return EXIT_FAILURE;
+  }
+
   uint8_t border_value = value;
 
   string window_name = "Composited Image";
@@ -142,31 +179,47 @@ int main(int argc, char* argv[]) {
   src_vertices[3].x = 0;
   src_vertices[3].y = src.rows - 1;
 
-  clock_t startTime = clock();
+  auto startTime = chrono::steady_clock::now();
 
   bool status = false;
-  cv::Mat map1;
-  cv::Mat map2;
-  status = ipcv::MapQ2Q(src, tgt, src_vertices, tgt_vertices, map1, map2);
-
   cv::Mat dst;
-//  cv::remap(src, dst, map1, map2, cv::INTER_NEAREST, cv::BORDER_CONSTANT,
-//            cv::Scalar(0, 0, 0) );
-  status = ipcv::Remap(src, dst, map1, map2, interpolation, border_mode,
-                       border_value);
+  if (warp) {
+    status = ipcv::WarpQ2Q(src, dst, tgt.size(), src_vertices, tgt_vertices,
+                           interpolation, border_mode, border_value);
+  } else {
+    cv::Mat map1;
+    cv::Mat map2;
+    status = ipcv::MapQ2Q(src, tgt, src_vertices, tgt_vertices, map1, map2);
+
+//    cv::remap(src, dst, map1, map2, cv::INTER_NEAREST, cv::BORDER_CONSTANT,
+//              cv::Scalar(0, 0, 0) );
+    if (fixed_point) {
+      cv::Mat xy;
+      cv::Mat fraction;
+      status = ipcv::ConvertMapsFixed(map1, map2, xy, fraction,
+                                      interpolation) &&
+               ipcv::RemapFixed(src, dst, xy, fraction, interpolation,
+                                border_mode, border_value);
+    } else {
+      status = ipcv::Remap(src, dst, map1, map2, interpolation, border_mode,
+                           value);
+    }
+  }
 
-  clock_t endTime = clock();
+  auto endTime = chrono::steady_clock::now();
 
   if (verbose) {
     cout << "Elapsed time: "
-         << (endTime - startTime) / static_cast<double>(CLOCKS_PER_SEC)
-         << " [s]" << endl;
+         << chrono::duration<double>(endTime - startTime).count() << " [s]"
+         << endl;
   }
 
-  cv::Mat mask = 255 - (dst * 255);
-  cv::Mat composite = (mask & tgt) + dst;
-
   if (status) {
+    cv::Mat dst_8u;
+    ipcv::ConvertTo8U(dst, tgt.type(), dst_8u);
+    cv::Mat mask = 255 - (dst_8u * 255);
+    cv::Mat composite = (mask & tgt) + dst_8u;
+
     if (dst_filename.empty()) {
       cv::imshow(window_name, composite);
       cv::waitKey(0);
@@ -0,0 +1,118 @@
+/** Implementation file for constant-time box filtering
+ *
+ *  \file ipcv/spatial_filtering/BoxFilter.cpp
+ *  \author Anthony Guarino (ag4933@rit.edu)
+ *  \date 16 Oct 2026
+ */
+
+#include "BoxFilter.h"
+
+#include <cstdint>
+#include <vector>
+
+using namespace std;
+
+namespace ipcv {
+
+/** Running-sum box correlation for sample type T accumulated in type Sum */
+template <typename T, typename Sum>
+static void CorrelateBoxRows(const cv::Mat& padded, const cv::Size& ksize,
+                             const float weight, const cv::Size& size,
+                             const std::function<void(const float*, int)>& sink) {
+  const int cn = padded.channels();
+  const int padded_length = padded.cols * cn;
+  const int length = size.width * cn;
+  const int span = ksize.width * cn;
+
+  vector<Sum> column_sums(padded_length, 0);
+  vector<float> accumulator(length);
+
+  // Sum the first ksize.height rows down every column
+  for (int r = 0; r < ksize.height; r++) {
+    const T* src_row = padded.ptr<T>(r);
+    for (int t = 0; t < padded_length; t++) {
+      column_sums[t] += src_row[t];
+    }
+  }
+
+  for (int row_idx = 0; row_idx < size.height; row_idx++) {
+    // Slide the window along the row, channel by channel
+    for (int c = 0; c < cn; c++) {
+      Sum window = 0;
+      for (int t = c; t < span; t += cn) {
+        window += column_sums[t];
+      }
+      accumulator[c] = weight * static_cast<float>(window);
+      for (int t = c + cn; t < length; t += cn) {
+        window += column_sums[t - cn + span] - column_sums[t - cn];
+        accumulator[t] = weight * static_cast<float>(window);
+      }
+    }
+
+    sink(accumulator.data(), row_idx);
+
+    // Move the column sums one row down
+    if (row_idx + 1 < size.height) {
+      const T* leaving = padded.ptr<T>(row_idx);
+      const T* entering = padded.ptr<T>(row_idx + ksize.height);
+      for (int t = 0; t < padded_length; t++) {
+        column_sums[t] += static_cast<Sum>(entering[t]) - leaving[t];
+      }
+    }
+  }
+}
+
+/** Correlate a padded image with a constant kernel using running sums
+ *
+ *  \param[in] padded  source padded by the box extent
+ *  \param[in] ksize   size of the box
+ *  \param[in] weight  value of every kernel element
+ *  \param[in] size    size of the output
+ *  \param[in] sink    called as sink(accumulator, row_idx) for every output
+ *                     row
+ */
+void CorrelateBox(const cv::Mat& padded, const cv::Size& ksize,
+                  const float weight, const cv::Size& size,
+                  const std::function<void(const float*, int)>& sink) {
+  switch (padded.depth()) {
+    case CV_8U:
+      CorrelateBoxRows<uchar, int64_t>(padded, ksize, weight, size, sink);
+      break;
+    case CV_16U:
+      CorrelateBoxRows<ushort, int64_t>(padded, ksize, weight, size, sink);
+      break;
+    case CV_16S:
+      CorrelateBoxRows<short, int64_t>(padded, ksize, weight, size, sink);
+      break;
+    default:
+      CorrelateBoxRows<float, double>(padded, ksize, weight, size, sink);
+      break;
+  }
+}
+
+/** Average an image over a rectangular window
+ *
+ *  \param[in] src          source cv::Mat (see Filter2D)
+ *  \param[out] dst         destination cv::Mat of ddepth depth with the
+ *                          channels of src
+ *  \param[in] ddepth       desired depth of the destination image
+ *  \param[in] ksize        size of the box
+ *  \param[in] anchor       anchor of the box (default is the center)
+ *  \param[in] delta        optional value added to the filtered pixels
+ *                          before storing them in dst
+ *  \param[in] border_mode  pixel extrapolation method
+ *  \param[in] border_value value to use for constant border mode
+ */
+bool BoxFilter(const cv::Mat& src, cv::Mat& dst, const int ddepth,
+               const cv::Size ksize, const cv::Point anchor, const int delta,
+               const BorderMode border_mode, uint8_t border_value) {
+  if (ksize.width <= 0 || ksize.height <= 0) {
+    return false;
+  }
+
+  const cv::Mat kernel(ksize, CV_32FC1,
+                       cv::Scalar::all(1.0 / ksize.area()));
+  return Filter2D(src, dst, ddepth, kernel, anchor, delta, border_mode,
+                  border_value);
+}
+}
@@ -0,0 +1,60 @@
+/** Interface file for constant-time box filtering
+ *
+ *  \file ipcv/spatial_filtering/BoxFilter.h
+ *  \author Anthony Guarino (ag4933@rit.edu)
+ *  \date 16 Oct 2026
+ */
+
+#pragma once
+
+#include <functional>
+
+#include <opencv2/core.hpp>
+
+#include "Filter2D.h"
+
+namespace ipcv {
+
+/** Average an image over a rectangular window
+ *
+ *  Equivalent to Filter2D with a constant kernel of 1 / (width * height),
+ *  which Filter2D evaluates with running sums at a cost per pixel that is
+ *  independent of the box size.
+ *
+ *  \param[in] src          source cv::Mat (see Filter2D)
+ *  \param[out] dst         destination cv::Mat of ddepth depth with the
+ *                          channels of src
+ *  \param[in] ddepth       desired depth of the destination image
+ *  \param[in] ksize        size of the box
+ *  \param[in] anchor       anchor of the box (default is the center)
+ *  \param[in] delta        optional value added to the filtered pixels
+ *                          before storing them in dst
+ *  \param[in] border_mode  pixel extrapolation method
+ *  \param[in] border_value value to use for constant border mode
+ */
+bool BoxFilter(const cv::Mat& src, cv::Mat& dst, const int ddepth,
+               const cv::Size ksize, const cv::Point anchor = cv::Point(-1, -1),
+               const int delta = 0,
+               const BorderMode border_mode = BorderMode::REPLICATE,
+               uint8_t border_value = 0);
+
+/** Correlate a padded image with a constant kernel using running sums
+ *
+ *  A running sum down every column is updated with one addition and one
+ *  subtraction per output row, and a running sum along the row of column
+ *  sums with one more of each per output sample.  Sums are exact integers
+ *  for integer samples.
+ *
+ *  \param[in] padded  source padded by the box extent (ksize.height - 1
+ *                     extra rows and ksize.width - 1 extra columns) with
+ *                     CV_8U, CV_16U, CV_16S or CV_32F samples
+ *  \param[in] ksize   size of the box
+ *  \param[in] weight  value of every kernel element
+ *  \param[in] size    size of the output
+ *  \param[in] sink    called as sink(accumulator, row_idx) with the
+ *                     size.width * channels weighted sums of every output row
+ */
+void CorrelateBox(const cv::Mat& padded, const cv::Size& ksize,
+                  const float weight, const cv::Size& size,
+                  const std::function<void(const float*, int)>& sink);
+}
@@ -0,0 +1,377 @@
+/** Implementation file for image filtering
+ *
+ *  \file ipcv/spatial_filtering/Filter2D.cpp
+ *  \author Anthony Guarino (ag4933@rit.edu)
+ *  \date 16 Oct 2026
+ */
+
+#include "Filter2D.h"
+#include "BoxFilter.h"
+#include "Filter2DFFT.h"
+#include "FixedKernel.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include <opencv2/core.hpp>
+
+#include "imgs/ipcv/parallel/TileExecutor.h"
+
+using namespace std;
+
+namespace ipcv {
+
+// Relative size of the second singular value below which a kernel is
+// treated as the outer product of a column and a row vector
+static const double kSeparableTolerance = 1e-6;
+
+// Multiply-adds per sample of the spatial path at and above which the
+// frequency domain path is used (a 15x15 general kernel by default)
+static int fft_crossover = 15 * 15;
+
+/** Split a kernel into a column and a row vector if it has rank one
+ *
+ *  \param[in] kernel   single-channel CV_32F kernel
+ *  \param[out] column  kernel.rows weights, cv::Mat of CV_32FC1
+ *  \param[out] row     kernel.cols weights, cv::Mat of CV_32FC1
+ */
+static bool SeparateKernel(const cv::Mat& kernel, cv::Mat& column,
+                           cv::Mat& row) {
+  // One-dimensional kernels need no decomposition
+  if (kernel.rows == 1) {
+    column = cv::Mat::ones(1, 1, CV_32F);
+    row = kernel.clone();
+    return true;
+  }
+  if (kernel.cols == 1) {
+    column = kernel.clone().reshape(1, 1);
+    row = cv::Mat::ones(1, 1, CV_32F);
+    return true;
+  }
+
+  cv::Mat kernel_double, w, u, vt;
+  kernel.convertTo(kernel_double, CV_64F);
+  cv::SVD::compute(kernel_double, w, u, vt);
+
+  const double s0 = w.at<double>(0);
+  if (s0 == 0 || w.at<double>(1) > kSeparableTolerance * s0) {
+    return false;
+  }
+
+  const double scale = std::sqrt(s0);
+  cv::Mat(u.col(0).t() * scale).convertTo(column, CV_32F);
+  cv::Mat(vt.row(0) * scale).convertTo(row, CV_32F);
+  return true;
+}
+
+/** Correlate one padded row with a row vector
+ *
+ *  \param[in] src     first sample of the padded source row
+ *  \param[in] row     row weights
+ *  \param[in] taps    number of row weights
+ *  \param[in] cn      number of interleaved channels
+ *  \param[in] length  number of output samples (cols * cn)
+ *  \param[out] dst    length filtered samples
+ */
+template <typename T>
+static void CorrelateRow(const T* src, const float* row, const int taps,
+                         const int cn, const int length, float* dst) {
+  std::fill(dst, dst + length, 0.0f);
+  for (int j = 0; j < taps; j++) {
+    const float w = row[j];
+    const T* p = src + j * cn;
+    for (int t = 0; t < length; t++) {
+      dst[t] += w * p[t];
+    }
+  }
+}
+
+/** Correlate a padded source with a separable kernel: a row pass into a
+ *  ring of kernel.rows buffered rows followed by a column pass
+ *
+ *  \param[in] padded   source padded by the kernel extent
+ *  \param[in] column   column weights
+ *  \param[in] row      row weights
+ *  \param[in] size     size of the output
+ *  \param[in] sink     called as sink(accumulator, row_idx) for every
+ *                      output row
+ */
+template <typename T, typename Sink>
+static void CorrelateSeparable(const cv::Mat& padded, const cv::Mat& column,
+                               const cv::Mat& row, const cv::Size& size,
+                               Sink sink) {
+  const int cn = padded.channels();
+  const int length = size.width * cn;
+  const int taps_y = column.cols;
+  const int taps_x = row.cols;
+  const float* column_weights = column.ptr<float>();
+  const float* row_weights = row.ptr<float>();
+
+  vector<float> ring(static_cast<size_t>(taps_y) * length);
+  vector<float> accumulator(length);
+
+  // Prime the ring with the first taps_y - 1 row-filtered rows
+  for (int r = 0; r < taps_y - 1; r++) {
+    CorrelateRow(padded.ptr<T>(r), row_weights, taps_x, cn, length,
+                 ring.data() + (r % taps_y) * length);
+  }
+
+  for (int row_idx = 0; row_idx < size.height; row_idx++) {
+    const int newest = row_idx + taps_y - 1;
+    CorrelateRow(padded.ptr<T>(newest), row_weights, taps_x, cn, length,
+                 ring.data() + (newest % taps_y) * length);
+
+    std::fill(accumulator.begin(), accumulator.end(), 0.0f);
+    for (int i = 0; i < taps_y; i++) {
+      const float w = column_weights[i];
+      const float* p = ring.data() + ((row_idx + i) % taps_y) * length;
+      for (int t = 0; t < length; t++) {
+        accumulator[t] += w * p[t];
+      }
+    }
+
+    sink(accumulator.data(), row_idx);
+  }
+}
+
+/** Correlate a padded source with a general two-dimensional kernel
+ *
+ *  \param[in] padded   source padded by the kernel extent
+ *  \param[in] kernel   single-channel CV_32F kernel
+ *  \param[in] size     size of the output
+ *  \param[in] sink     called as sink(accumulator, row_idx) for every
+ *                      output row
+ */
+template <typename T, typename Sink>
+static void CorrelateDirect(const cv::Mat& padded, const cv::Mat& kernel,
+                            const cv::Size& size, Sink sink) {
+  const int cn = padded.channels();
+  const int length = size.width * cn;
+  vector<float> accumulator(length);
+
+  for (int row_idx = 0; row_idx < size.height; row_idx++) {
+    std::fill(accumulator.begin(), accumulator.end(), 0.0f);
+    for (int i = 0; i < kernel.rows; i++) {
+      const T* src_row = padded.ptr<T>(row_idx + i);
+      const float* kernel_row = kernel.ptr<float>(i);
+      for (int j = 0; j < kernel.cols; j++) {
+        const float w = kernel_row[j];
+        if (w == 0.0f) {
+          continue;
+        }
+        const T* p = src_row + j * cn;
+        for (int t = 0; t < length; t++) {
+          accumulator[t] += w * p[t];
+        }
+      }
+    }
+
+    sink(accumulator.data(), row_idx);
+  }
+}
+
+/** Correlate a padded source of sample type T in the spatial domain */
+template <typename T, typename Sink>
+static void Correlate(const cv::Mat& padded, const cv::Mat& kernel,
+                      const bool separable, const cv::Mat& column,
+                      const cv::Mat& row, const cv::Size& size, Sink sink) {
+  if (separable) {
+    CorrelateSeparable<T>(padded, column, row, size, sink);
+  } else {
+    CorrelateDirect<T>(padded, kernel, size, sink);
+  }
+}
+
+/** Set the cost at and above which Filter2D correlates in the frequency
+ *  domain
+ *
+ *  \param[in] taps  multiply-adds per sample of the spatial path
+ */
+void SetFilter2DFFTCrossover(const int taps) { fft_crossover = taps; }
+
+/** Cost at and above which Filter2D correlates in the frequency domain */
+int GetFilter2DFFTCrossover() { return fft_crossover; }
+
+/** Correlates an image with the provided kernel
+ *
+ *  Rank-one kernels (e.g. box and Gaussian blurs) are detected with a
+ *  singular value decomposition and applied as a row pass followed by a
+ *  column pass, costing kernel.rows + kernel.cols operations per sample
+ *  instead of kernel.rows * kernel.cols.  3x3 and 5x5 integer kernels on
+ *  CV_8U images run in 16-bit fixed point (see FixedKernel).  Constant
+ *  (box) kernels use running sums at a cost independent of their size.
+ *  Kernels whose spatial cost reaches the FFT crossover are correlated tile
+ *  by tile in the frequency domain instead (see CorrelateFFT).  Every path
+ *  runs tile by tile on the shared TileExecutor.
+ *
+ *  \param[in] src          source cv::Mat (CV_8U, CV_16U, CV_16S or CV_32F
+ *                          samples with any number of channels)
+ *  \param[out] dst         destination cv::Mat of ddepth depth with the
+ *                          channels of src
+ *  \param[in] ddepth       desired depth of the destination image
+ *  \param[in] kernel       correlation kernel, a single-channel floating
+ *                          point matrix
+ *  \param[in] anchor       anchor of the kernel (default is the center)
+ *  \param[in] delta        optional value added to the filtered pixels
+ *                          before storing them in dst
+ *  \param[in] border_mode  pixel extrapolation method (ISOLATED leaves the
+ *                          band where the kernel does not fit inside the
+ *                          image unfiltered)
+ *  \param[in] border_value value to use for constant border mode
+ */
+bool Filter2D(const cv::Mat& src, cv::Mat& dst, const int ddepth,
+              const cv::Mat& kernel, const cv::Point anchor, const int delta,
+              const BorderMode border_mode, uint8_t border_value) {
+  if (src.empty() || kernel.empty() || kernel.channels() != 1) {
+    return false;
+  }
+  if (src.depth() != CV_8U && src.depth() != CV_16U &&
+      src.depth() != CV_16S && src.depth() != CV_32F) {
+    return false;
+  }
+
+  cv::Point new_anchor = anchor;
+  if (new_anchor.x < 0 || new_anchor.y < 0) {
+    new_anchor = cv::Point(kernel.cols / 2, kernel.rows / 2);
+  }
+  if (new_anchor.x >= kernel.cols || new_anchor.y >= kernel.rows) {
+    return false;
+  }
+
+  cv::Mat kernel_float;
+  kernel.convertTo(kernel_float, CV_32F);
+
+  // Every tile reads the kernel extent around it (extrapolated past the
+  // image edges); filtering in place needs a copy of the source, which
+  // also serves as the unfiltered band when the border band is isolated
+  const int top = new_anchor.y;
+  const int bottom = kernel.rows - 1 - new_anchor.y;
+  const int left = new_anchor.x;
+  const int right = kernel.cols - 1 - new_anchor.x;
+  TileHalo halo;
+  halo.top = top;
+  halo.bottom = bottom;
+  halo.left = left;
+  halo.right = right;
+  TileBorder border;
+  if (border_mode == BorderMode::CONSTANT) {
+    border.type = cv::BORDER_CONSTANT;
+    border.value = cv::Scalar::all(border_value);
+  }
+
+  const cv::Mat source = (src.data == dst.data) ? src.clone() : src;
+
+  const int cn = source.channels();
+  const int depth = CV_MAT_DEPTH(ddepth);
+  dst.create(source.size(), CV_MAKETYPE(depth, cn));
+
+  // Add delta, saturate and store each filtered row of a tile
+  auto tile_sink = [&](const cv::Rect& rect) {
+    return [&, rect](const float* accumulator, int row_idx) {
+      const cv::Mat accumulator_row(1, rect.width * cn, CV_32FC1,
+                                    const_cast<float*>(accumulator));
+      cv::Mat dst_row(1, rect.width * cn, CV_MAKETYPE(depth, 1),
+                      dst.ptr(rect.y + row_idx) + rect.x * dst.elemSize());
+      accumulator_row.convertTo(dst_row, depth, 1, delta);
+    };
+  };
+
+  // Constant kernels cost the same at any size with running sums;
+  // otherwise pick the cheaper of the spatial and frequency domain paths
+  double min_weight, max_weight;
+  cv::minMaxLoc(kernel_float, &min_weight, &max_weight);
+  const bool constant = (min_weight == max_weight && min_weight != 0);
+
+  cv::Mat column, row;
+  const bool separable =
+      !constant && SeparateKernel(kernel_float, column, row);
+  const int taps =
+      separable ? kernel.rows + kernel.cols : kernel.rows * kernel.cols;
+
+  // Small integer kernels on 8-bit images run in 16-bit fixed point
+  FixedKernel<3, 3> fixed3x3;
+  FixedKernel<5, 5> fixed5x5;
+  const bool fixed_point = (source.depth() == CV_8U && depth == CV_8U);
+  const bool fixed3x3_path =
+      fixed_point && MakeFixedKernel(kernel_float, delta, fixed3x3);
+  const bool fixed5x5_path = fixed_point && !fixed3x3_path &&
+                             MakeFixedKernel(kernel_float, delta, fixed5x5);
+
+  TileExecutor& executor = SharedTileExecutor();
+  if (fixed3x3_path || fixed5x5_path) {
+    executor.Run(source, halo, border,
+                 [&](const cv::Mat& tile, const cv::Rect& rect, int) {
+                   cv::Mat dst_tile = dst(rect);
+                   if (fixed3x3_path) {
+                     CorrelateFixed(tile, fixed3x3, dst_tile);
+                   } else {
+                     CorrelateFixed(tile, fixed5x5, dst_tile);
+                   }
+                 });
+  } else if (constant) {
+    executor.Run(source, halo, border,
+                 [&](const cv::Mat& tile, const cv::Rect& rect, int) {
+                   CorrelateBox(tile, kernel.size(),
+                                static_cast<float>(min_weight), rect.size(),
+                                tile_sink(rect));
+                 });
+  } else if (taps >= fft_crossover) {
+    // The frequency domain path runs its own overlap-save tiles (on the
+    // same executor) over a padded copy
+    cv::Mat padded;
+    cv::copyMakeBorder(source, padded, top, bottom, left, right, border.type,
+                       border.value);
+    CorrelateFFT(padded, kernel_float, source.size(),
+                 [&](const cv::Mat& tile, const cv::Rect& rect) {
+                   cv::Mat dst_tile = dst(rect);
+                   tile.convertTo(dst_tile, depth, 1, delta);
+                 });
+  } else {
+    executor.Run(
+        source, halo, border,
+        [&](const cv::Mat& tile, const cv::Rect& rect, int) {
+          switch (source.depth()) {
+            case CV_8U:
+              Correlate<uchar>(tile, kernel_float, separable, column, row,
+                               rect.size(), tile_sink(rect));
+              break;
+            case CV_16U:
+              Correlate<ushort>(tile, kernel_float, separable, column, row,
+                                rect.size(), tile_sink(rect));
+              break;
+            case CV_16S:
+              Correlate<short>(tile, kernel_float, separable, column, row,
+                               rect.size(), tile_sink(rect));
+              break;
+            default:
+              Correlate<float>(tile, kernel_float, separable, column, row,
+                               rect.size(), tile_sink(rect));
+              break;
+          }
+        });
+  }
+
+  // Copy the band where the kernel does not fit from the source
+  if (border_mode == BorderMode::ISOLATED) {
+    const int interior_rows = std::max(src.rows - top - bottom, 0);
+    const int interior_cols = std::max(src.cols - left - right, 0);
+    const cv::Rect bands[] = {
+        cv::Rect(0, 0, src.cols, std::min(top, src.rows)),
+        cv::Rect(0, std::min(top + interior_rows, src.rows), src.cols,
+                 src.rows - std::min(top + interior_rows, src.rows)),
+        cv::Rect(0, top, std::min(left, src.cols), interior_rows),
+        cv::Rect(std::min(left + interior_cols, src.cols), top,
+                 src.cols - std::min(left + interior_cols, src.cols),
+                 interior_rows)};
+    for (const auto& band : bands) {
+      if (band.area() > 0) {
+        cv::Mat dst_band = dst(band);
+        source(band).convertTo(dst_band, depth);
+      }
+    }
+  }
+
+  return true;
+}
+}
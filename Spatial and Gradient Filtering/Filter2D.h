@@ -40,4 +40,20 @@ bool Filter2D(const cv::Mat& src, cv::Mat& dst, const int ddepth,
               const int delta = 0,
               const BorderMode border_mode = BorderMode::REPLICATE,
               uint8_t border_value = 0);
+
+/** Set the cost at and above which Filter2D correlates in the frequency
+ *  domain (overlap-save over tiles) instead of directly
+ *
+ *  The cost of the spatial path is kernel.rows + kernel.cols multiply-adds
+ *  per sample for separable kernels and kernel.rows * kernel.cols
+ *  otherwise; use the spatial_filter benchmark to measure the crossover on
+ *  a given machine (0 always uses the frequency domain, INT_MAX never does)
+ *
+ *  \param[in] taps  multiply-adds per sample [default is 225, i.e. a
+ *                   general 15x15 kernel]
+ */
+void SetFilter2DFFTCrossover(const int taps);
+
+/** Cost at and above which Filter2D correlates in the frequency domain */
+int GetFilter2DFFTCrossover();
 }
@@ -0,0 +1,217 @@
+/** Implementation file for filtering with a bank of kernels in one pass
+ *
+ *  \file ipcv/spatial_filtering/Filter2DBank.cpp
+ *  \author Anthony Guarino (ag4933@rit.edu)
+ *  \date 16 Oct 2026
+ */
+
+#include "Filter2DBank.h"
+
+#include <algorithm>
+#include <map>
+#include <utility>
+
+using namespace std;
+
+namespace ipcv {
+
+// Number of samples of a row filtered at a time
+static const int kBlockLength = 512;
+
+/** Neighbour offset (in the padded source) and the kernels using it
+ *
+ *  \var dy       row offset from the first padded row of the output row
+ *  \var dx       sample offset from the first padded sample of the block
+ *  \var kernels  index of every kernel with a non-zero weight here
+ *  \var weights  the corresponding weights
+ */
+struct BankOffset {
+  int dy;
+  int dx;
+  vector<int> kernels;
+  vector<float> weights;
+};
+
+/** Sweep a padded source of sample type T once, accumulating every kernel
+ *
+ *  \param[in] padded   source padded for the largest kernel
+ *  \param[in] offsets  neighbour offsets with their kernels and weights
+ *  \param[in] count    number of kernels
+ *  \param[in] size     size of the outputs
+ *  \param[in] sink     called as sink(k, accumulator, row_idx, first,
+ *                      length) with each block of filtered samples
+ */
+template <typename T, typename Sink>
+static void CorrelateBank(const cv::Mat& padded,
+                          const vector<BankOffset>& offsets, const int count,
+                          const cv::Size& size, Sink sink) {
+  const int cn = padded.channels();
+  const int length = size.width * cn;
+  vector<float> accumulators(static_cast<size_t>(count) * kBlockLength);
+
+  for (int row_idx = 0; row_idx < size.height; row_idx++) {
+    for (int first = 0; first < length; first += kBlockLength) {
+      const int block = std::min(kBlockLength, length - first);
+      std::fill(accumulators.begin(), accumulators.end(), 0.0f);
+
+      for (const auto& offset : offsets) {
+        const T* p = padded.ptr<T>(row_idx + offset.dy) + offset.dx + first;
+        for (size_t n = 0; n < offset.kernels.size(); n++) {
+          const float w = offset.weights[n];
+          float* accumulator =
+              accumulators.data() + offset.kernels[n] * kBlockLength;
+          for (int t = 0; t < block; t++) {
+            accumulator[t] += w * p[t];
+          }
+        }
+      }
+
+      for (int k = 0; k < count; k++) {
+        sink(k, accumulators.data() + k * kBlockLength, row_idx, first,
+             block);
+      }
+    }
+  }
+}
+
+/** Correlates an image with several kernels in a single sweep
+ *
+ *  \param[in] src          source cv::Mat (see Filter2D)
+ *  \param[out] dst         one destination cv::Mat per kernel
+ *  \param[in] ddepth       desired depth of the destination images
+ *  \param[in] kernels      correlation kernels
+ *  \param[in] deltas       value added to the filtered pixels of each kernel
+ *  \param[in] border_mode  pixel extrapolation method
+ *  \param[in] border_value value to use for constant border mode
+ */
+bool Filter2DBank(const cv::Mat& src, vector<cv::Mat>& dst, const int ddepth,
+                  const vector<cv::Mat>& kernels, const vector<int>& deltas,
+                  const BorderMode border_mode, uint8_t border_value) {
+  const int count = static_cast<int>(kernels.size());
+  if (src.empty() || count == 0 ||
+      (!deltas.empty() && static_cast<int>(deltas.size()) != count)) {
+    return false;
+  }
+  if (src.depth() != CV_8U && src.depth() != CV_16U &&
+      src.depth() != CV_16S && src.depth() != CV_32F) {
+    return false;
+  }
+
+  // Filtering in place: an output sharing data with the source would
+  // overwrite it before the isolated border bands are copied
+  bool in_place = false;
+  for (const auto& output : dst) {
+    in_place = in_place || (output.data == src.data);
+  }
+  const cv::Mat source = in_place ? src.clone() : src;
+
+  // Pad once for the largest extent in every direction
+  int top = 0, bottom = 0, left = 0, right = 0;
+  for (const auto& kernel : kernels) {
+    if (kernel.empty() || kernel.channels() != 1) {
+      return false;
+    }
+    top = std::max(top, kernel.rows / 2);
+    bottom = std::max(bottom, kernel.rows - 1 - kernel.rows / 2);
+    left = std::max(left, kernel.cols / 2);
+    right = std::max(right, kernel.cols - 1 - kernel.cols / 2);
+  }
+
+  cv::Mat padded;
+  if (border_mode == BorderMode::CONSTANT) {
+    cv::copyMakeBorder(src, padded, top, bottom, left, right,
+                       cv::BORDER_CONSTANT, cv::Scalar::all(border_value));
+  } else {
+    cv::copyMakeBorder(src, padded, top, bottom, left, right,
+                       cv::BORDER_REPLICATE);
+  }
+
+  // Group the non-zero weights of all kernels by neighbour offset
+  const int cn = src.channels();
+  map<pair<int, int>, BankOffset> grouped;
+  for (int k = 0; k < count; k++) {
+    cv::Mat kernel_float;
+    kernels[k].convertTo(kernel_float, CV_32F);
+    const int row_shift = top - kernel_float.rows / 2;
+    const int col_shift = left - kernel_float.cols / 2;
+    for (int i = 0; i < kernel_float.rows; i++) {
+      for (int j = 0; j < kernel_float.cols; j++) {
+        const float w = kernel_float.at<float>(i, j);
+        if (w == 0.0f) {
+          continue;
+        }
+        BankOffset& offset =
+            grouped[make_pair(row_shift + i, col_shift + j)];
+        offset.dy = row_shift + i;
+        offset.dx = (col_shift + j) * cn;
+        offset.kernels.push_back(k);
+        offset.weights.push_back(w);
+      }
+    }
+  }
+  vector<BankOffset> offsets;
+  for (auto& entry : grouped) {
+    offsets.push_back(std::move(entry.second));
+  }
+
+  const int depth = CV_MAT_DEPTH(ddepth);
+  dst.resize(count);
+  for (auto& output : dst) {
+    output.create(src.size(), CV_MAKETYPE(depth, cn));
+  }
+
+  // Add delta, saturate and store each filtered block
+  auto sink = [&](int k, const float* accumulator, int row_idx, int first,
+                  int length) {
+    const cv::Mat accumulator_block(1, length, CV_32FC1,
+                                    const_cast<float*>(accumulator));
+    cv::Mat dst_block(1, length, CV_MAKETYPE(depth, 1),
+                      dst[k].ptr(row_idx) + first * dst[k].elemSize1());
+    accumulator_block.convertTo(dst_block, depth, 1,
+                                deltas.empty() ? 0 : deltas[k]);
+  };
+
+  switch (src.depth()) {
+    case CV_8U:
+      CorrelateBank<uchar>(padded, offsets, count, src.size(), sink);
+      break;
+    case CV_16U:
+      CorrelateBank<ushort>(padded, offsets, count, src.size(), sink);
+      break;
+    case CV_16S:
+      CorrelateBank<short>(padded, offsets, count, src.size(), sink);
+      break;
+    default:
+      CorrelateBank<float>(padded, offsets, count, src.size(), sink);
+      break;
+  }
+
+  // Copy the band where each kernel does not fit from the source
+  if (border_mode == BorderMode::ISOLATED) {
+    for (int k = 0; k < count; k++) {
+      const int k_top = kernels[k].rows / 2;
+      const int k_bottom = kernels[k].rows - 1 - k_top;
+      const int k_left = kernels[k].cols / 2;
+      const int k_right = kernels[k].cols - 1 - k_left;
+      const int interior_rows = std::max(src.rows - k_top - k_bottom, 0);
+      const int interior_cols = std::max(src.cols - k_left - k_right, 0);
+      const cv::Rect bands[] = {
+          cv::Rect(0, 0, src.cols, std::min(k_top, src.rows)),
+          cv::Rect(0, std::min(k_top + interior_rows, src.rows), src.cols,
+                   src.rows - std::min(k_top + interior_rows, src.rows)),
+          cv::Rect(0, k_top, std::min(k_left, src.cols), interior_rows),
+          cv::Rect(std::min(k_left + interior_cols, src.cols), k_top,
+                   src.cols - std::min(k_left + interior_cols, src.cols),
+                   interior_rows)};
+      for (const auto& band : bands) {
+        if (band.area() > 0) {
+          cv::Mat dst_band = dst[k](band);
+          source(band).convertTo(dst_band, depth);
+        }
+      }
+    }
+  }
+
+  return true;
+}
+}
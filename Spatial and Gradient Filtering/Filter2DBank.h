@@ -0,0 +1,43 @@
+/** Interface file for filtering with a bank of kernels in one pass
+ *
+ *  \file ipcv/spatial_filtering/Filter2DBank.h
+ *  \author Anthony Guarino (ag4933@rit.edu)
+ *  \date 16 Oct 2026
+ */
+
+#pragma once
+
+#include <vector>
+
+#include <opencv2/core.hpp>
+
+#include "Filter2D.h"
+
+namespace ipcv {
+
+/** Correlates an image with several kernels in a single sweep
+ *
+ *  The source is padded once for the largest kernel and swept once, one row
+ *  at a time in blocks of columns small enough for the accumulators of all
+ *  kernels to stay in the L1 cache; the samples at every neighbour offset
+ *  used by any kernel are loaded once and accumulated into all the kernels
+ *  that have a non-zero weight there.  Each output matches Filter2D with
+ *  the same kernel and delta (every kernel is anchored at its center).
+ *
+ *  \param[in] src          source cv::Mat (see Filter2D)
+ *  \param[out] dst         one destination cv::Mat of ddepth depth with the
+ *                          channels of src per kernel
+ *  \param[in] ddepth       desired depth of the destination images
+ *  \param[in] kernels      correlation kernels, single-channel floating
+ *                          point matrices
+ *  \param[in] deltas       value added to the filtered pixels of each kernel
+ *                          (empty means zero for all)
+ *  \param[in] border_mode  pixel extrapolation method
+ *  \param[in] border_value value to use for constant border mode
+ */
+bool Filter2DBank(const cv::Mat& src, std::vector<cv::Mat>& dst,
+                  const int ddepth, const std::vector<cv::Mat>& kernels,
+                  const std::vector<int>& deltas = std::vector<int>(),
+                  const BorderMode border_mode = BorderMode::REPLICATE,
+                  uint8_t border_value = 0);
+}
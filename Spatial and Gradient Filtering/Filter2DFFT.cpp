@@ -0,0 +1,156 @@
+/** Implementation file for FFT-based correlation
+ *
+ *  \file ipcv/spatial_filtering/Filter2DFFT.cpp
+ *  \author Anthony Guarino (ag4933@rit.edu)
+ *  \date 16 Oct 2026
+ */
+
+#include "Filter2DFFT.h"
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "imgs/ipcv/parallel/TileExecutor.h"
+
+using namespace std;
+
+namespace ipcv {
+
+// Smallest output tile side; larger kernels get proportionally larger tiles
+// so the overlap stays a small fraction of every DFT
+static const int kMinimumTileSize = 128;
+
+// Largest number of kernel spectra kept per thread
+static const size_t kMaximumCachedSpectra = 16;
+
+/** Kernel spectra computed so far, keyed on DFT size and kernel weights */
+using SpectrumKey = tuple<int, int, int, int, string>;
+static thread_local map<SpectrumKey, cv::Mat> spectrum_cache;
+
+/** Return the (CCS packed) spectrum of the kernel zero-padded to dft_size,
+ *  computing it only the first time
+ *
+ *  \param[in] kernel    single-channel CV_32F correlation kernel
+ *  \param[in] dft_size  size of the DFT
+ */
+static const cv::Mat& KernelSpectrum(const cv::Mat& kernel,
+                                     const cv::Size& dft_size) {
+  const cv::Mat kernel_continuous =
+      kernel.isContinuous() ? kernel : kernel.clone();
+  SpectrumKey key(dft_size.width, dft_size.height, kernel.cols, kernel.rows,
+                  string(reinterpret_cast<const char*>(kernel_continuous.data),
+                         kernel.total() * kernel.elemSize()));
+
+  auto cached = spectrum_cache.find(key);
+  if (cached != spectrum_cache.end()) {
+    return cached->second;
+  }
+
+  if (spectrum_cache.size() >= kMaximumCachedSpectra) {
+    spectrum_cache.clear();
+  }
+
+  cv::Mat padded_kernel = cv::Mat::zeros(dft_size, CV_32FC1);
+  cv::Mat kernel_region =
+      padded_kernel(cv::Rect(0, 0, kernel.cols, kernel.rows));
+  kernel.copyTo(kernel_region);
+  cv::Mat& spectrum = spectrum_cache[key];
+  cv::dft(padded_kernel, spectrum, 0, kernel.rows);
+  return spectrum;
+}
+
+/** DFT buffers of one worker */
+struct FFTScratch {
+  cv::Mat region_float;
+  cv::Mat buffer;
+  cv::Mat spectrum;
+  cv::Mat correlated;
+  cv::Mat tile;
+};
+
+/** Correlate a padded image with a kernel in the frequency domain, one
+ *  tile at a time
+ *
+ *  \param[in] padded  source padded by the kernel extent
+ *  \param[in] kernel  single-channel CV_32F correlation kernel
+ *  \param[in] size    size of the output
+ *  \param[in] sink    called as sink(tile, rect) with each tile of
+ *                     correlated samples and its location in the output
+ *                     (concurrently, from the workers of the shared tile
+ *                     executor)
+ */
+void CorrelateFFT(
+    const cv::Mat& padded, const cv::Mat& kernel, const cv::Size& size,
+    const std::function<void(const cv::Mat&, const cv::Rect&)>& sink) {
+  const int cn = padded.channels();
+
+  // Choose the DFT size, then the largest output tile that fits in it
+  const cv::Size dft_size(
+      cv::getOptimalDFTSize(
+          std::max(kMinimumTileSize, 4 * kernel.cols) + kernel.cols - 1),
+      cv::getOptimalDFTSize(
+          std::max(kMinimumTileSize, 4 * kernel.rows) + kernel.rows - 1));
+  const cv::Size tile_size(dft_size.width - kernel.cols + 1,
+                           dft_size.height - kernel.rows + 1);
+
+  // Computed once on the calling thread, then only read by the workers
+  const cv::Mat& kernel_spectrum = KernelSpectrum(kernel, dft_size);
+
+  // Overlap-save tiles are independent, so they run as separate tasks
+  TileExecutor& executor = SharedTileExecutor();
+  vector<FFTScratch> scratches(executor.Threads());
+  const int tile_cols = (size.width + tile_size.width - 1) / tile_size.width;
+  const int tile_rows =
+      (size.height + tile_size.height - 1) / tile_size.height;
+
+  executor.Run(tile_cols * tile_rows, [&](int index, int worker) {
+    FFTScratch& scratch = scratches[worker];
+    if (scratch.buffer.empty()) {
+      scratch.buffer.create(dft_size, CV_32FC1);
+      scratch.tile.create(tile_size, CV_32FC(cn));
+    }
+
+    const int x = (index % tile_cols) * tile_size.width;
+    const int y = (index / tile_cols) * tile_size.height;
+    const cv::Rect rect(x, y, std::min(tile_size.width, size.width - x),
+                        std::min(tile_size.height, size.height - y));
+    const cv::Rect region(x, y, rect.width + kernel.cols - 1,
+                          rect.height + kernel.rows - 1);
+    padded(region).convertTo(scratch.region_float, CV_32F);
+    cv::Mat tile_out = scratch.tile(cv::Rect(0, 0, rect.width, rect.height));
+
+    for (int c = 0; c < cn; c++) {
+      // Zero-pad the channel of the source region to the DFT size
+      scratch.buffer.setTo(0);
+      cv::Mat buffer_region =
+          scratch.buffer(cv::Rect(0, 0, region.width, region.height));
+      if (cn == 1) {
+        scratch.region_float.copyTo(buffer_region);
+      } else {
+        cv::extractChannel(scratch.region_float, buffer_region, c);
+      }
+
+      // Correlation is the product with the conjugate kernel spectrum
+      cv::dft(scratch.buffer, scratch.spectrum, 0, region.height);
+      cv::mulSpectrums(scratch.spectrum, kernel_spectrum, scratch.spectrum, 0,
+                       true);
+      cv::idft(scratch.spectrum, scratch.correlated,
+               cv::DFT_SCALE | cv::DFT_REAL_OUTPUT, rect.height);
+
+      // The first rect samples are free of circular wrap-around
+      const cv::Mat valid =
+          scratch.correlated(cv::Rect(0, 0, rect.width, rect.height));
+      if (cn == 1) {
+        valid.copyTo(tile_out);
+      } else {
+        cv::insertChannel(valid, tile_out, c);
+      }
+    }
+
+    sink(tile_out, rect);
+  });
+}
+}
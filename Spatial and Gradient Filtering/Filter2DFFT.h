@@ -0,0 +1,41 @@
+/** Interface file for FFT-based correlation
+ *
+ *  \file ipcv/spatial_filtering/Filter2DFFT.h
+ *  \author Anthony Guarino (ag4933@rit.edu)
+ *  \date 16 Oct 2026
+ */
+
+#pragma once
+
+#include <functional>
+
+#include <opencv2/core.hpp>
+
+namespace ipcv {
+
+/** Correlate a padded image with a kernel in the frequency domain, one
+ *  tile at a time
+ *
+ *  Each output tile is produced from a (tile + kernel - 1) region of the
+ *  padded source with one forward DFT per channel, a spectrum product with
+ *  the conjugated kernel spectrum and one inverse DFT (overlap-save).  The
+ *  kernel spectrum depends only on the kernel and the DFT size, so it is
+ *  computed once per DFT size and cached for later calls on the same
+ *  thread.  The tiles are independent and run in parallel on the shared
+ *  TileExecutor.
+ *
+ *  \param[in] padded  source padded by the kernel extent (kernel.rows - 1
+ *                     extra rows and kernel.cols - 1 extra columns) with
+ *                     CV_8U, CV_16U, CV_16S or CV_32F samples
+ *  \param[in] kernel  single-channel CV_32F correlation kernel
+ *  \param[in] size    size of the output
+ *  \param[in] sink    called as sink(tile, rect) with each tile of
+ *                     correlated samples (CV_32F with the channels of
+ *                     padded) and its location in the output; tiles
+ *                     are disjoint and the sink is called concurrently
+ *                     from several workers
+ */
+void CorrelateFFT(
+    const cv::Mat& padded, const cv::Mat& kernel, const cv::Size& size,
+    const std::function<void(const cv::Mat&, const cv::Rect&)>& sink);
+}
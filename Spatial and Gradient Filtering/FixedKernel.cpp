@@ -0,0 +1,262 @@
+/** Implementation file for fixed-size integer correlation kernels
+ *
+ *  \file ipcv/spatial_filtering/FixedKernel.cpp
+ *  \author Anthony Guarino (ag4933@rit.edu)
+ *  \date 16 Oct 2026
+ */
+
+#include "FixedKernel.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#define IPCV_FIXED_X86 1
+#include <immintrin.h>
+#endif
+
+using namespace std;
+
+namespace ipcv {
+
+/** Build a fixed kernel if the kernel and delta can be evaluated in
+ *  saturating 16-bit fixed point without ever saturating on CV_8U input
+ *
+ *  \param[in] kernel   single-channel floating point kernel of Rows x Cols
+ *  \param[in] delta    value added to the filtered samples
+ *  \param[out] fixed   integer weights and delta
+ */
+template <int Rows, int Cols>
+bool MakeFixedKernel(const cv::Mat& kernel, const int delta,
+                     FixedKernel<Rows, Cols>& fixed) {
+  if (kernel.rows != Rows || kernel.cols != Cols || kernel.channels() != 1) {
+    return false;
+  }
+
+  cv::Mat kernel_double;
+  kernel.convertTo(kernel_double, CV_64F);
+
+  // Largest possible magnitude of any partial sum
+  long bound = std::labs(delta);
+  fixed.byte_weights = true;
+  for (int i = 0; i < Rows; i++) {
+    for (int j = 0; j < Cols; j++) {
+      const double weight = kernel_double.at<double>(i, j);
+      if (weight != std::round(weight) || std::fabs(weight) > INT16_MAX) {
+        return false;
+      }
+      fixed.weights[i * Cols + j] = static_cast<int16_t>(weight);
+      fixed.byte_weights &= (weight >= INT8_MIN && weight <= INT8_MAX);
+      bound += 255 * std::labs(static_cast<long>(weight));
+    }
+  }
+  if (bound > INT16_MAX) {
+    return false;
+  }
+
+  fixed.delta = static_cast<int16_t>(delta);
+  return true;
+}
+
+/** Scalar row kernel, one sample per iteration from sample first on */
+template <int Rows, int Cols>
+static void CorrelateFixedRowScalar(const uint8_t* const* rows, const int cn,
+                                    const int first, const int length,
+                                    const FixedKernel<Rows, Cols>& kernel,
+                                    uint8_t* dst) {
+  for (int t = first; t < length; t++) {
+    int sum = kernel.delta;
+    for (int i = 0; i < Rows; i++) {
+      for (int j = 0; j < Cols; j++) {
+        sum += kernel.weights[i * Cols + j] * rows[i][t + j * cn];
+      }
+    }
+    dst[t] = static_cast<uint8_t>(std::min(std::max(sum, 0), 255));
+  }
+}
+
+#if IPCV_FIXED_X86
+/** SSE2 row kernel, eight adjacent samples per iteration */
+template <int Rows, int Cols>
+static void CorrelateFixedRowSse2(const uint8_t* const* rows, const int cn,
+                                  const int first, const int length,
+                                  const FixedKernel<Rows, Cols>& kernel,
+                                  uint8_t* dst) {
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i delta = _mm_set1_epi16(kernel.delta);
+  __m128i weights[Rows * Cols];
+  for (int k = 0; k < Rows * Cols; k++) {
+    weights[k] = _mm_set1_epi16(kernel.weights[k]);
+  }
+
+  int t = first;
+  for (; t + 8 <= length; t += 8) {
+    __m128i sum = delta;
+#pragma GCC unroll 5
+    for (int i = 0; i < Rows; i++) {
+#pragma GCC unroll 5
+      for (int j = 0; j < Cols; j++) {
+        const __m128i samples = _mm_unpacklo_epi8(
+            _mm_loadl_epi64(
+                reinterpret_cast<const __m128i*>(rows[i] + t + j * cn)),
+            zero);
+        sum = _mm_adds_epi16(
+            sum, _mm_mullo_epi16(samples, weights[i * Cols + j]));
+      }
+    }
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + t),
+                     _mm_packus_epi16(sum, sum));
+  }
+
+  CorrelateFixedRowScalar(rows, cn, t, length, kernel, dst);
+}
+
+/** AVX2 row kernel, sixteen adjacent samples per iteration */
+template <int Rows, int Cols>
+__attribute__((target("avx2"))) static void CorrelateFixedRowAvx2(
+    const uint8_t* const* rows, const int cn, const int length,
+    const FixedKernel<Rows, Cols>& kernel, uint8_t* dst) {
+  const __m256i delta = _mm256_set1_epi16(kernel.delta);
+  __m256i weights[Rows * Cols];
+  for (int k = 0; k < Rows * Cols; k++) {
+    weights[k] = _mm256_set1_epi16(kernel.weights[k]);
+  }
+
+  int t = 0;
+  for (; t + 16 <= length; t += 16) {
+    __m256i sum = delta;
+#pragma GCC unroll 5
+    for (int i = 0; i < Rows; i++) {
+#pragma GCC unroll 5
+      for (int j = 0; j < Cols; j++) {
+        const __m256i samples = _mm256_cvtepu8_epi16(_mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(rows[i] + t + j * cn)));
+        sum = _mm256_adds_epi16(
+            sum, _mm256_mullo_epi16(samples, weights[i * Cols + j]));
+      }
+    }
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + t),
+                     _mm_packus_epi16(_mm256_castsi256_si128(sum),
+                                      _mm256_extracti128_si256(sum, 1)));
+  }
+
+  CorrelateFixedRowSse2(rows, cn, t, length, kernel, dst);
+}
+
+/** AVX2 row kernel for weights that fit in 8 bits, thirty-two adjacent
+ *  samples per iteration
+ *
+ *  Samples under two taps are interleaved byte by byte so that a single
+ *  multiply-add of unsigned samples by signed byte weights evaluates both
+ *  taps at once.
+ */
+template <int Rows, int Cols>
+__attribute__((target("avx2"))) static void CorrelateFixedRowAvx2Pairs(
+    const uint8_t* const* rows, const int cn, const int length,
+    const FixedKernel<Rows, Cols>& kernel, uint8_t* dst) {
+  constexpr int kPairs = (Rows * Cols + 1) / 2;
+  const __m256i delta = _mm256_set1_epi16(kernel.delta);
+
+  // Sample pointers and weights of both taps of every pair (an odd tap
+  // count is completed with a zero weight)
+  const uint8_t* taps[2 * kPairs];
+  __m256i weights[kPairs];
+  for (int k = 0; k < 2 * kPairs; k++) {
+    const int tap = (k < Rows * Cols) ? k : 0;
+    taps[k] = rows[tap / Cols] + (tap % Cols) * cn;
+  }
+  for (int p = 0; p < kPairs; p++) {
+    const int16_t second =
+        (2 * p + 1 < Rows * Cols) ? kernel.weights[2 * p + 1] : 0;
+    weights[p] = _mm256_set1_epi16(static_cast<int16_t>(
+        static_cast<uint8_t>(kernel.weights[2 * p]) |
+        (static_cast<uint8_t>(second) << 8)));
+  }
+
+  int t = 0;
+  for (; t + 32 <= length; t += 32) {
+    __m256i sum_low = delta;
+    __m256i sum_high = delta;
+#pragma GCC unroll 13
+    for (int p = 0; p < kPairs; p++) {
+      const __m256i first = _mm256_loadu_si256(
+          reinterpret_cast<const __m256i*>(taps[2 * p] + t));
+      const __m256i second = _mm256_loadu_si256(
+          reinterpret_cast<const __m256i*>(taps[2 * p + 1] + t));
+      sum_low = _mm256_adds_epi16(
+          sum_low, _mm256_maddubs_epi16(_mm256_unpacklo_epi8(first, second),
+                                        weights[p]));
+      sum_high = _mm256_adds_epi16(
+          sum_high, _mm256_maddubs_epi16(_mm256_unpackhi_epi8(first, second),
+                                         weights[p]));
+    }
+
+    // Unpacking and packing within 128-bit lanes restores the sample order
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + t),
+                        _mm256_packus_epi16(sum_low, sum_high));
+  }
+
+  CorrelateFixedRowSse2(rows, cn, t, length, kernel, dst);
+}
+#endif
+
+/** Correlate one row of CV_8U samples with a fixed kernel
+ *
+ *  \param[in] rows    Rows pointers to the first sample of each padded
+ *                     source row under the kernel
+ *  \param[in] cn      number of interleaved channels
+ *  \param[in] length  number of output samples (cols * cn)
+ *  \param[in] kernel  integer weights and delta
+ *  \param[out] dst    length filtered samples
+ */
+template <int Rows, int Cols>
+void CorrelateFixedRow(const uint8_t* const* rows, const int cn,
+                       const int length, const FixedKernel<Rows, Cols>& kernel,
+                       uint8_t* dst) {
+#if IPCV_FIXED_X86
+  static const bool avx2 = __builtin_cpu_supports("avx2");
+  if (avx2 && kernel.byte_weights) {
+    CorrelateFixedRowAvx2Pairs(rows, cn, length, kernel, dst);
+  } else if (avx2) {
+    CorrelateFixedRowAvx2(rows, cn, length, kernel, dst);
+  } else {
+    CorrelateFixedRowSse2(rows, cn, 0, length, kernel, dst);
+  }
+#else
+  CorrelateFixedRowScalar(rows, cn, 0, length, kernel, dst);
+#endif
+}
+
+/** Correlate a padded CV_8U image with a fixed kernel
+ *
+ *  \param[in] padded  source padded by the kernel extent
+ *  \param[in] kernel  integer weights and delta
+ *  \param[out] dst    destination cv::Mat of CV_8U (already allocated)
+ */
+template <int Rows, int Cols>
+void CorrelateFixed(const cv::Mat& padded,
+                    const FixedKernel<Rows, Cols>& kernel, cv::Mat& dst) {
+  const int length = dst.cols * dst.channels();
+  const uint8_t* rows[Rows];
+
+  for (int row_idx = 0; row_idx < dst.rows; row_idx++) {
+    for (int i = 0; i < Rows; i++) {
+      rows[i] = padded.ptr<uint8_t>(row_idx + i);
+    }
+    CorrelateFixedRow(rows, dst.channels(), length, kernel,
+                      dst.ptr<uint8_t>(row_idx));
+  }
+}
+
+template bool MakeFixedKernel(const cv::Mat&, const int, FixedKernel<3, 3>&);
+template bool MakeFixedKernel(const cv::Mat&, const int, FixedKernel<5, 5>&);
+template void CorrelateFixedRow(const uint8_t* const*, const int, const int,
+                                const FixedKernel<3, 3>&, uint8_t*);
+template void CorrelateFixedRow(const uint8_t* const*, const int, const int,
+                                const FixedKernel<5, 5>&, uint8_t*);
+template void CorrelateFixed(const cv::Mat&, const FixedKernel<3, 3>&,
+                             cv::Mat&);
+template void CorrelateFixed(const cv::Mat&, const FixedKernel<5, 5>&,
+                             cv::Mat&);
+}
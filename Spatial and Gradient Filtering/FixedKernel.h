@@ -0,0 +1,82 @@
+/** Interface file for fixed-size integer correlation kernels
+ *
+ *  \file ipcv/spatial_filtering/FixedKernel.h
+ *  \author Anthony Guarino (ag4933@rit.edu)
+ *  \date 16 Oct 2026
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include <opencv2/core.hpp>
+
+namespace ipcv {
+
+/** Integer correlation kernel whose size is known at compile time
+ *
+ *  The tap loops of the kernels below have compile-time bounds and are
+ *  fully unrolled; the weights are broadcast into registers once per call.
+ *  Filter2D dispatches 3x3 and 5x5 integer kernels (e.g. sharpen and
+ *  Laplacian) on CV_8U images here.
+ *
+ *  \var weights       Rows x Cols weights in row-major order
+ *  \var delta         value added to every filtered sample
+ *  \var byte_weights  every weight fits in a signed byte, so two taps can
+ *                     be evaluated per multiply-add
+ */
+template <int Rows, int Cols>
+struct FixedKernel {
+  static constexpr int kRows = Rows;
+  static constexpr int kCols = Cols;
+  static constexpr int kTaps = Rows * Cols;
+
+  int16_t weights[Rows * Cols];
+  int16_t delta;
+  bool byte_weights;
+};
+
+/** Build a fixed kernel if the kernel and delta can be evaluated in
+ *  saturating 16-bit fixed point without ever saturating on CV_8U input
+ *
+ *  \param[in] kernel   single-channel floating point kernel of Rows x Cols
+ *  \param[in] delta    value added to the filtered samples
+ *  \param[out] fixed   integer weights and delta
+ *  \return true if every weight is an integer and
+ *          255 * sum(|weights|) + |delta| fits in 16 bits
+ */
+template <int Rows, int Cols>
+bool MakeFixedKernel(const cv::Mat& kernel, const int delta,
+                     FixedKernel<Rows, Cols>& fixed);
+
+/** Correlate one row of CV_8U samples with a fixed kernel
+ *
+ *  Samples are widened to 16 bits, multiplied and accumulated with
+ *  saturating 16-bit additions, then packed back to 8 bits with unsigned
+ *  saturation.  Thirty-two (AVX2 with byte weights, two taps per
+ *  multiply-add), sixteen (AVX2) or eight (SSE2) adjacent samples are
+ *  processed per iteration.
+ *
+ *  \param[in] rows    Rows pointers to the first sample of each padded
+ *                     source row under the kernel
+ *  \param[in] cn      number of interleaved channels
+ *  \param[in] length  number of output samples (cols * cn)
+ *  \param[in] kernel  integer weights and delta
+ *  \param[out] dst    length filtered samples
+ */
+template <int Rows, int Cols>
+void CorrelateFixedRow(const uint8_t* const* rows, const int cn,
+                       const int length, const FixedKernel<Rows, Cols>& kernel,
+                       uint8_t* dst);
+
+/** Correlate a padded CV_8U image with a fixed kernel
+ *
+ *  \param[in] padded  source padded by the kernel extent
+ *  \param[in] kernel  integer weights and delta
+ *  \param[out] dst    destination cv::Mat of CV_8U with the channels of
+ *                     padded (already allocated)
+ */
+template <int Rows, int Cols>
+void CorrelateFixed(const cv::Mat& padded,
+                    const FixedKernel<Rows, Cols>& kernel, cv::Mat& dst);
+}
@@ -0,0 +1,68 @@
+/** Interface file for recursive (constant-time) Gaussian blurring
+ *
+ *  \file ipcv/spatial_filtering/GaussianBlur.h
+ *  \author Anthony Guarino (ag4933@rit.edu)
+ *  \date 16 Oct 2026
+ */
+
+#pragma once
+
+#include <opencv2/core.hpp>
+
+#include "Filter2D.h"
+
+namespace ipcv {
+
+/** Blur an image with a recursive approximation of a Gaussian
+ *
+ *  Uses the third-order Young-van Vliet recursive filter: a causal and an
+ *  anti-causal pass down the columns, then the same along the rows (run as
+ *  column passes on the transposed image), so every pass works on whole
+ *  rows of samples at a time and the cost per pixel does not depend on
+ *  sigma.  The anti-causal passes start from the exact state of an
+ *  infinitely extended border (Triggs-Sdika), so REPLICATE and CONSTANT
+ *  borders carry no start-up transient.  ISOLATED filters as REPLICATE and
+ *  then leaves the band of width ceil(3 sigma) unfiltered.
+ *
+ *  \param[in] src          source cv::Mat (CV_8U, CV_16U, CV_16S or CV_32F
+ *                          samples with any number of channels, at least
+ *                          4x4 pixels)
+ *  \param[out] dst         destination cv::Mat of ddepth depth with the
+ *                          channels of src
+ *  \param[in] ddepth       desired depth of the destination image
+ *  \param[in] sigma        standard deviation of the Gaussian (at least 0.5)
+ *  \param[in] border_mode  pixel extrapolation method
+ *  \param[in] border_value value to use for constant border mode
+ */
+bool GaussianBlur(const cv::Mat& src, cv::Mat& dst, const int ddepth,
+                  const double sigma,
+                  const BorderMode border_mode = BorderMode::REPLICATE,
+                  uint8_t border_value = 0);
+
+/** Accuracy and speed of the recursive Gaussian against a sampled kernel
+ *
+ *  \var sigma              standard deviation of the Gaussian
+ *  \var max_error          largest absolute difference (in source units)
+ *  \var rms_error          root mean square difference (in source units)
+ *  \var recursive_seconds  time taken by GaussianBlur
+ *  \var sampled_seconds    time taken by Filter2D with the sampled kernel
+ */
+struct GaussianAccuracy {
+  double sigma;
+  double max_error;
+  double rms_error;
+  double recursive_seconds;
+  double sampled_seconds;
+};
+
+/** Compare GaussianBlur with Filter2D using a Gaussian kernel sampled out
+ *  to ceil(4 sigma) and normalized to unit sum (both with REPLICATE borders
+ *  and CV_32F output)
+ *
+ *  \param[in] src        source cv::Mat (see GaussianBlur)
+ *  \param[in] sigma      standard deviation of the Gaussian
+ *  \param[out] accuracy  differences and timings
+ */
+bool GaussianBlurAccuracy(const cv::Mat& src, const double sigma,
+                          GaussianAccuracy& accuracy);
+}
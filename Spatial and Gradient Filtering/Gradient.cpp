@@ -0,0 +1,143 @@
+/** Implementation file for fused Sobel gradient computation
+ *
+ *  \file ipcv/spatial_filtering/Gradient.cpp
+ *  \author Anthony Guarino (ag4933@rit.edu)
+ *  \date 16 Oct 2026
+ */
+
+#include "Gradient.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using namespace std;
+
+namespace ipcv {
+
+/** Convert one source row to gray, reflecting one pixel past either end
+ *
+ *  \param[in] src    source row of CV_8UC3 (BGR) or CV_8UC1 pixels
+ *  \param[in] cols   number of pixels in the row
+ *  \param[in] cn     number of channels (3 or 1)
+ *  \param[out] gray  cols + 2 gray samples, gray[1] being the first pixel
+ */
+static void GrayRow(const uchar* src, const int cols, const int cn,
+                    int* gray) {
+  if (cn == 1) {
+    for (int col = 0; col < cols; col++) {
+      gray[col + 1] = src[col];
+    }
+  } else {
+    // Fixed-point weights of cv::COLOR_BGR2GRAY (14 fractional bits)
+    for (int col = 0; col < cols; col++) {
+      const uchar* p = src + 3 * col;
+      gray[col + 1] = (p[0] * 1868 + p[1] * 9617 + p[2] * 4899 + 8192) >> 14;
+    }
+  }
+
+  gray[0] = gray[(cols > 1) ? 2 : 1];
+  gray[cols + 1] = gray[(cols > 1) ? cols - 1 : cols];
+}
+
+/** Compute the 3x3 Sobel gradient of an 8-bit image in a single pass
+ *
+ *  \param[in] src             source cv::Mat of CV_8UC3 (BGR) or CV_8UC1
+ *  \param[out] gradient       gradient images and their ranges
+ *  \param[in] direction_bins  number of direction bins (at most 256)
+ */
+bool Gradient(const cv::Mat& src, GradientImages& gradient,
+              const int direction_bins) {
+  if ((src.type() != CV_8UC3 && src.type() != CV_8UC1) ||
+      direction_bins < 1 || direction_bins > 256) {
+    return false;
+  }
+
+  const int rows = src.rows;
+  const int cols = src.cols;
+  const int cn = src.channels();
+
+  gradient.gx.create(src.size(), CV_16SC1);
+  gradient.gy.create(src.size(), CV_16SC1);
+  gradient.magnitude.create(src.size(), CV_32FC1);
+  gradient.direction.create(src.size(), CV_8UC1);
+
+  int gx_min = numeric_limits<int>::max();
+  int gx_max = numeric_limits<int>::min();
+  int gy_min = gx_min, gy_max = gx_max;
+  float magnitude_min = numeric_limits<float>::max(), magnitude_max = 0;
+  int direction_min = direction_bins, direction_max = -1;
+  const float bins_per_degree = direction_bins / 360.0f;
+
+  // Ring of three padded gray rows (above, current, below)
+  vector<int> ring(3 * (cols + 2));
+  auto gray_row = [&](int row) {
+    return ring.data() + (row % 3) * (cols + 2);
+  };
+
+  GrayRow(src.ptr<uchar>(0), cols, cn, gray_row(0));
+
+  for (int row_idx = 0; row_idx < rows; row_idx++) {
+    // Read the row below, replacing the row two above in the ring
+    if (row_idx + 1 < rows) {
+      GrayRow(src.ptr<uchar>(row_idx + 1), cols, cn, gray_row(row_idx + 1));
+    }
+
+    // Rows past the top and bottom edges are reflected about the edge row
+    const int reflected_above =
+        (row_idx > 0) ? row_idx - 1 : std::min(1, rows - 1);
+    const int reflected_below =
+        (row_idx + 1 < rows) ? row_idx + 1 : std::max(rows - 2, 0);
+    const int* above = gray_row(reflected_above);
+    const int* center = gray_row(row_idx);
+    const int* below = gray_row(reflected_below);
+
+    short* gx_row = gradient.gx.ptr<short>(row_idx);
+    short* gy_row = gradient.gy.ptr<short>(row_idx);
+    float* magnitude_row = gradient.magnitude.ptr<float>(row_idx);
+    uchar* direction_row = gradient.direction.ptr<uchar>(row_idx);
+
+    for (int col = 0; col < cols; col++) {
+      const int c = col + 1;
+      const int gx = (above[c + 1] - above[c - 1]) +
+                     2 * (center[c + 1] - center[c - 1]) +
+                     (below[c + 1] - below[c - 1]);
+      const int gy = (below[c - 1] + 2 * below[c] + below[c + 1]) -
+                     (above[c - 1] + 2 * above[c] + above[c + 1]);
+      const float magnitude =
+          std::sqrt(static_cast<float>(gx * gx + gy * gy));
+      const int bin = std::min(
+          static_cast<int>(cv::fastAtan2(static_cast<float>(gy),
+                                         static_cast<float>(gx)) *
+                           bins_per_degree),
+          direction_bins - 1);
+
+      gx_row[col] = static_cast<short>(gx);
+      gy_row[col] = static_cast<short>(gy);
+      magnitude_row[col] = magnitude;
+      direction_row[col] = static_cast<uchar>(bin);
+
+      gx_min = std::min(gx_min, gx);
+      gx_max = std::max(gx_max, gx);
+      gy_min = std::min(gy_min, gy);
+      gy_max = std::max(gy_max, gy);
+      magnitude_min = std::min(magnitude_min, magnitude);
+      magnitude_max = std::max(magnitude_max, magnitude);
+      direction_min = std::min(direction_min, bin);
+      direction_max = std::max(direction_max, bin);
+    }
+  }
+
+  gradient.gx_min = gx_min;
+  gradient.gx_max = gx_max;
+  gradient.gy_min = gy_min;
+  gradient.gy_max = gy_max;
+  gradient.magnitude_min = magnitude_min;
+  gradient.magnitude_max = magnitude_max;
+  gradient.direction_min = direction_min;
+  gradient.direction_max = direction_max;
+
+  return true;
+}
+}
@@ -0,0 +1,51 @@
+/** Interface file for fused Sobel gradient computation
+ *
+ *  \file ipcv/spatial_filtering/Gradient.h
+ *  \author Anthony Guarino (ag4933@rit.edu)
+ *  \date 16 Oct 2026
+ */
+
+#pragma once
+
+#include <opencv2/core.hpp>
+
+namespace ipcv {
+
+/** Sobel gradient of an image together with the range of every output
+ *
+ *  \var gx             horizontal derivative, cv::Mat of CV_16SC1
+ *  \var gy             vertical derivative, cv::Mat of CV_16SC1
+ *  \var magnitude      gradient magnitude, cv::Mat of CV_32FC1
+ *  \var direction      gradient direction quantized to direction_bins
+ *                      equal bins over [0, 360) degrees, cv::Mat of CV_8UC1
+ *  \var gx_min, gx_max                 range of gx
+ *  \var gy_min, gy_max                 range of gy
+ *  \var magnitude_min, magnitude_max   range of magnitude
+ *  \var direction_min, direction_max   range of direction
+ */
+struct GradientImages {
+  cv::Mat gx;
+  cv::Mat gy;
+  cv::Mat magnitude;
+  cv::Mat direction;
+  double gx_min, gx_max;
+  double gy_min, gy_max;
+  double magnitude_min, magnitude_max;
+  double direction_min, direction_max;
+};
+
+/** Compute the 3x3 Sobel gradient of an 8-bit image in a single pass
+ *
+ *  Each source row is read once and converted to gray (with the weights of
+ *  cv::COLOR_BGR2GRAY) into a ring of three rows, from which Gx, Gy, the
+ *  magnitude and the quantized direction are written and their ranges
+ *  updated, so no further pass is needed to normalize them.  Borders are
+ *  reflected about the edge pixel, as by cv::Sobel.
+ *
+ *  \param[in] src             source cv::Mat of CV_8UC3 (BGR) or CV_8UC1
+ *  \param[out] gradient       gradient images and their ranges
+ *  \param[in] direction_bins  number of direction bins (at most 256)
+ */
+bool Gradient(const cv::Mat& src, GradientImages& gradient,
+              const int direction_bins = 256);
+}
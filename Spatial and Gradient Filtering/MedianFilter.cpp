@@ -0,0 +1,205 @@
+/** Implementation file for constant-time median filtering
+ *
+ *  \file ipcv/spatial_filtering/MedianFilter.cpp
+ *  \author Anthony Guarino (ag4933@rit.edu)
+ *  \date 16 Oct 2026
+ */
+
+#include "MedianFilter.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+using namespace std;
+
+namespace ipcv {
+
+/** Histogram of one column (or of the window) split into two levels
+ *
+ *  \var coarse  counts of the upper four bits of the samples
+ *  \var fine    counts of every sample value, as 16 segments of 16 bins
+ */
+struct MedianHistogram {
+  uint16_t coarse[16];
+  uint16_t fine[16][16];
+};
+
+/** Median filter the rows [first_row, last_row) of the output
+ *
+ *  \param[in] padded     source padded by radius on every side
+ *  \param[out] dst       destination cv::Mat
+ *  \param[in] radius     window radius
+ *  \param[in] first_row  first output row of the strip
+ *  \param[in] last_row   one past the last output row of the strip
+ */
+static void MedianStrip(const cv::Mat& padded, cv::Mat& dst, const int radius,
+                        const int first_row, const int last_row) {
+  const int cn = padded.channels();
+  const int cols = dst.cols;
+  const int padded_cols = padded.cols;
+  const int diameter = 2 * radius + 1;
+  const int rank = diameter * diameter / 2;
+
+  // One column histogram per padded column and channel, starting with the
+  // window rows of the first output row
+  vector<MedianHistogram> columns(static_cast<size_t>(padded_cols) * cn);
+  std::memset(columns.data(), 0, columns.size() * sizeof(MedianHistogram));
+  auto update_columns = [&](const int padded_row, const int change) {
+    const uchar* p = padded.ptr<uchar>(padded_row);
+    for (int t = 0; t < padded_cols * cn; t++) {
+      MedianHistogram& column = columns[t];
+      column.coarse[p[t] >> 4] += change;
+      column.fine[p[t] >> 4][p[t] & 15] += change;
+    }
+  };
+  for (int k = 0; k < diameter - 1; k++) {
+    update_columns(first_row + k, 1);
+  }
+
+  MedianHistogram window;
+  int segment_column[16];
+
+  for (int row_idx = first_row; row_idx < last_row; row_idx++) {
+    // Slide the column histograms down one row
+    if (row_idx > first_row) {
+      update_columns(row_idx - 1, -1);
+    }
+    update_columns(row_idx + diameter - 1, 1);
+
+    uchar* dst_row = dst.ptr<uchar>(row_idx);
+
+    for (int c = 0; c < cn; c++) {
+      auto column = [&](const int col) -> const MedianHistogram& {
+        return columns[col * cn + c];
+      };
+
+      // Coarse window histogram of the first window; the fine segments are
+      // filled when first needed
+      std::memset(window.coarse, 0, sizeof(window.coarse));
+      for (int col = 0; col < diameter; col++) {
+        for (int k = 0; k < 16; k++) {
+          window.coarse[k] += column(col).coarse[k];
+        }
+      }
+      std::fill(segment_column, segment_column + 16, -diameter);
+
+      for (int col = 0; col < cols; col++) {
+        // Coarse bin holding the median
+        int count = 0;
+        int k = 0;
+        while (count + window.coarse[k] <= rank) {
+          count += window.coarse[k];
+          k++;
+        }
+
+        // Bring the fine segment of that bin up to the current window
+        uint16_t* segment = window.fine[k];
+        if (col - segment_column[k] >= diameter) {
+          std::memset(segment, 0, 16 * sizeof(uint16_t));
+          for (int j = col; j < col + diameter; j++) {
+            const uint16_t* fine = column(j).fine[k];
+            for (int b = 0; b < 16; b++) {
+              segment[b] += fine[b];
+            }
+          }
+        } else {
+          for (int j = segment_column[k]; j < col; j++) {
+            const uint16_t* leaving = column(j).fine[k];
+            const uint16_t* entering = column(j + diameter).fine[k];
+            for (int b = 0; b < 16; b++) {
+              segment[b] += entering[b] - leaving[b];
+            }
+          }
+        }
+        segment_column[k] = col;
+
+        int b = 0;
+        while (count + segment[b] <= rank) {
+          count += segment[b];
+          b++;
+        }
+        dst_row[col * cn + c] = static_cast<uchar>(16 * k + b);
+
+        // Slide the coarse window histogram one column right
+        if (col + 1 < cols) {
+          const uint16_t* leaving = column(col).coarse;
+          const uint16_t* entering = column(col + diameter).coarse;
+          for (int n = 0; n < 16; n++) {
+            window.coarse[n] += entering[n] - leaving[n];
+          }
+        }
+      }
+    }
+  }
+}
+
+/** Median filter an 8-bit image over a square window of any radius
+ *
+ *  \param[in] src          source cv::Mat of CV_8UC1 or CV_8UC3
+ *  \param[out] dst         destination cv::Mat of the type of src
+ *  \param[in] radius       window radius
+ *  \param[in] border_mode  pixel extrapolation method
+ *  \param[in] border_value value to use for constant border mode
+ *  \param[in] strips       number of horizontal strips filtered in parallel
+ */
+bool MedianFilter(const cv::Mat& src, cv::Mat& dst, const int radius,
+                  const BorderMode border_mode, uint8_t border_value,
+                  const int strips) {
+  if ((src.type() != CV_8UC1 && src.type() != CV_8UC3) || src.empty() ||
+      radius < 1 || radius > 127 || strips < 0) {
+    return false;
+  }
+
+  cv::Mat padded;
+  if (border_mode == BorderMode::CONSTANT) {
+    cv::copyMakeBorder(src, padded, radius, radius, radius, radius,
+                       cv::BORDER_CONSTANT, cv::Scalar::all(border_value));
+  } else {
+    cv::copyMakeBorder(src, padded, radius, radius, radius, radius,
+                       cv::BORDER_REPLICATE);
+  }
+
+  dst.create(src.size(), src.type());
+
+  // Each strip rebuilds its column histograms, so keep strips well taller
+  // than the window
+  const int requested = (strips == 0) ? cv::getNumThreads() : strips;
+  const int strip_count = std::max(
+      1, std::min(requested, src.rows / std::max(2 * radius + 1, 16)));
+  if (strip_count == 1) {
+    MedianStrip(padded, dst, radius, 0, src.rows);
+  } else {
+    cv::parallel_for_(cv::Range(0, strip_count), [&](const cv::Range& range) {
+      for (int strip = range.start; strip < range.end; strip++) {
+        MedianStrip(padded, dst, radius, strip * src.rows / strip_count,
+                    (strip + 1) * src.rows / strip_count);
+      }
+    });
+  }
+
+  // Copy the band where the window does not fit from the (padded copy of
+  // the) source, which stays valid when dst is src
+  if (border_mode == BorderMode::ISOLATED) {
+    const int band_rows = std::min(radius, src.rows / 2);
+    const int band_cols = std::min(radius, src.cols / 2);
+    const cv::Rect bands[] = {
+        cv::Rect(0, 0, src.cols, band_rows),
+        cv::Rect(0, src.rows - band_rows, src.cols, band_rows),
+        cv::Rect(0, band_rows, band_cols, src.rows - 2 * band_rows),
+        cv::Rect(src.cols - band_cols, band_rows, band_cols,
+                 src.rows - 2 * band_rows)};
+    for (const auto& rect : bands) {
+      if (rect.area() > 0) {
+        cv::Mat dst_band = dst(rect);
+        const cv::Rect padded_rect(rect.x + radius, rect.y + radius,
+                                   rect.width, rect.height);
+        padded(padded_rect).copyTo(dst_band);
+      }
+    }
+  }
+
+  return true;
+}
+}
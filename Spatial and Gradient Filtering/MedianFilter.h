@@ -0,0 +1,40 @@
+/** Interface file for constant-time median filtering
+ *
+ *  \file ipcv/spatial_filtering/MedianFilter.h
+ *  \author Anthony Guarino (ag4933@rit.edu)
+ *  \date 16 Oct 2026
+ */
+
+#pragma once
+
+#include <opencv2/core.hpp>
+
+#include "Filter2D.h"
+
+namespace ipcv {
+
+/** Median filter an 8-bit image over a square window of any radius
+ *
+ *  Follows Perreault and Hebert: every column of the padded source keeps a
+ *  histogram of the 2 * radius + 1 samples above and below the current row
+ *  (one sample leaves and one enters per row), and the window histogram
+ *  slides along the row by subtracting one column histogram and adding
+ *  another.  Window histograms are kept as 16 coarse bins, always current,
+ *  and 16 fine segments of 16 bins that are only brought up to date when
+ *  the median falls in them, so the cost per pixel does not depend on the
+ *  radius.  ISOLATED leaves the band of width radius unfiltered.
+ *
+ *  \param[in] src          source cv::Mat of CV_8UC1 or CV_8UC3
+ *  \param[out] dst         destination cv::Mat of the type of src
+ *  \param[in] radius       window radius (window is 2 * radius + 1 square,
+ *                          1 to 127)
+ *  \param[in] border_mode  pixel extrapolation method
+ *  \param[in] border_value value to use for constant border mode
+ *  \param[in] strips       number of horizontal strips filtered in
+ *                          parallel, each with its own histograms (0 uses
+ *                          one per OpenCV worker thread)
+ */
+bool MedianFilter(const cv::Mat& src, cv::Mat& dst, const int radius,
+                  const BorderMode border_mode = BorderMode::REPLICATE,
+                  uint8_t border_value = 0, const int strips = 1);
+}
@@ -3,12 +3,20 @@
 #include <boost/program_options.hpp>
 #include <opencv2/core.hpp>
 #include <opencv2/highgui.hpp>
-#include <opencv2/imgproc.hpp>
+#include "imgs/ipcv/spatial_filtering/Gradient.h"
 
 using namespace std;
 
 namespace po = boost::program_options;
 
+// Stretch [min, max] to [0, 255] in 8 bits (as cv::NORM_MINMAX would, but
+// with the range already known)
+static void Normalize(const cv::Mat& src, double min, double max,
+                      cv::Mat& dst) {
+    const double scale = (max > min) ? 255 / (max - min) : 0;
+    src.convertTo(dst, CV_8U, scale, -min * scale);
+}
+
 int main(int argc, char* argv[]) {
     bool verbose = false;
     string src_filename = "";
@@ -48,24 +56,16 @@ int main(int argc, char* argv[]) {
         return EXIT_FAILURE;
     }
 
-    cv::Mat gray, dst_x, dst_y;
-    cv::cvtColor(src, gray, cv::COLOR_BGR2GRAY);
-
-    cv::Sobel(gray, dst_x, CV_16S, 1, 0, 3);
-    cv::Sobel(gray, dst_y, CV_16S, 0, 1, 3);
-
-    cv::Mat float_dst_x, float_dst_y;
-    dst_x.convertTo(float_dst_x, CV_32F);
-    dst_y.convertTo(float_dst_y, CV_32F);
-
-    cv::Mat magnitude, direction;
-    cv::magnitude(float_dst_x, float_dst_y, magnitude);
-    cv::phase(float_dst_x, float_dst_y, direction, true);
+    ipcv::GradientImages gradient;
+    ipcv::Gradient(src, gradient);
 
-    cv::normalize(magnitude, magnitude, 0, 255, cv::NORM_MINMAX, CV_8U);
-    cv::normalize(dst_x, dst_x, 0, 255, cv::NORM_MINMAX, CV_8U);
-    cv::normalize(dst_y, dst_y, 0, 255, cv::NORM_MINMAX, CV_8U);
-    cv::normalize(direction, direction, 0, 255, cv::NORM_MINMAX, CV_8U);
+    cv::Mat dst_x, dst_y, magnitude, direction;
+    Normalize(gradient.magnitude, gradient.magnitude_min,
+              gradient.magnitude_max, magnitude);
+    Normalize(gradient.gx, gradient.gx_min, gradient.gx_max, dst_x);
+    Normalize(gradient.gy, gradient.gy_min, gradient.gy_max, dst_y);
+    Normalize(gradient.direction, gradient.direction_min,
+              gradient.direction_max, direction);
 
     if (verbose) {
         cv::imshow("Original Color", src);
@@ -1,23 +1,102 @@
-#include <ctime>
+#include <chrono>
+#include <climits>
 #include <iostream>
 #include <boost/filesystem.hpp>
 #include <boost/program_options.hpp>
 #include <opencv2/core.hpp>
 #include <opencv2/highgui.hpp>
 #include "imgs/ipcv/spatial_filtering/Filter2D.h"
+#include "imgs/ipcv/spatial_filtering/Filter2DBank.h"
+#include "imgs/ipcv/spatial_filtering/GaussianBlur.h"
+#include "imgs/ipcv/spatial_filtering/MedianFilter.h"
 
 using namespace std;
 
 namespace po = boost::program_options;
 
+/** Build one of the predefined kernels
+ *
+ *  \param[in] kernel_type  kernel type (see the --kernel-type option)
+ *  \param[in] box_size     width and height of the box kernel (type 4)
+ *  \param[out] kernel      correlation kernel
+ *  \param[out] ddepth      desired depth of the destination image
+ *  \param[out] delta       value added to the filtered pixels
+ */
+static bool MakeKernel(const int kernel_type, const int box_size,
+                       cv::Mat& kernel, int& ddepth, int& delta) {
+  switch (kernel_type) {
+    case 0:
+      kernel.create(3, 3, CV_32FC1);
+      kernel = 1;
+      kernel /= 9;
+      ddepth = CV_8UC3;
+      delta = 0;
+      break;
+
+    case 1:
+      kernel.create(5, 5, CV_32FC1);
+      kernel = 1;
+      kernel /= 25;
+      ddepth = CV_8UC3;
+      delta = 0;
+      break;
+
+    case 2:
+      kernel.create(3, 3, CV_32FC1);
+      kernel = -1;
+      kernel.at<float>(0, 0) = 0;
+      kernel.at<float>(2, 0) = 0;
+      kernel.at<float>(1, 1) = 5;
+      kernel.at<float>(0, 2) = 0;
+      kernel.at<float>(2, 2) = 0;
+      kernel /= 1;
+      ddepth = CV_8UC3;
+      delta = 0;
+      break;
+
+    case 3:
+      kernel.create(3, 3, CV_32FC1);
+      kernel = -1;
+      kernel.at<float>(0, 0) = 0;
+      kernel.at<float>(2, 0) = 0;
+      kernel.at<float>(1, 1) = 4;
+      kernel.at<float>(0, 2) = 0;
+      kernel.at<float>(2, 2) = 0;
+      kernel /= 1;
+      ddepth = CV_8UC3;
+      delta = 128;
+      break;
+
+    case 4:
+      kernel.create(box_size, box_size, CV_32FC1);
+      kernel = 1;
+      kernel /= box_size * box_size;
+      ddepth = CV_8UC3;
+      delta = 0;
+      break;
+
+    default:
+      return false;
+  }
+
+  return true;
+}
+
 int main(int argc, char* argv[]) {
   bool verbose = false;
   string src_filename = "";
   string dst_filename = "";
 
   int kernel_type = 0;
+  int box_size = 3;
+  double sigma = 2.0;
+  int median_radius = 1;
+  int strips = 1;
   int border_value = 0;       // Default value for constant border mode
   int border_type_input = 1;  // Default to replicate mode
+  bool benchmark = false;
+  bool bank = false;
+  bool gaussian_accuracy = false;
 
   po::options_description options("Options");
   options.add_options()("help,h", "display this message")(
@@ -26,11 +105,33 @@ int main(int argc, char* argv[]) {
       "destination-filename,o", po::value<string>(&dst_filename),
       "destination filename")("kernel-type,k", po::value<int>(&kernel_type),
                               "kernel type (0 is blur, 1 is more blur, 2 is "
-                              "sharpen, 3 is Laplacian) [default is 0]")(
+                              "sharpen, 3 is Laplacian, 4 is box of "
+                              "box-size, 5 is recursive Gaussian of sigma, "
+                              "6 is median of median-radius) "
+                              "[default is 0]")(
+      "box-size,s", po::value<int>(&box_size),
+      "width and height of the box kernel (kernel type 4) [default is 3]")(
+      "sigma", po::value<double>(&sigma),
+      "standard deviation of the Gaussian (kernel type 5) [default is 2]")(
+      "median-radius,r", po::value<int>(&median_radius),
+      "radius of the median window (kernel type 6) [default is 1]")(
+      "strips", po::value<int>(&strips),
+      "number of horizontal strips median filtered in parallel (0 is one "
+      "per thread) [default is 1]")(
       "border-value,b", po::value<int>(&border_value),
       "border value for constant border mode [default is 0]")(
       "border-type,t", po::value<int>(&border_type_input),
-      "border type (0 is constant, 1 is replicate [default], 2 is isolated)");
+      "border type (0 is constant, 1 is replicate [default], 2 is isolated)")(
+      "benchmark", po::bool_switch(&benchmark),
+      "time the spatial and frequency domain paths for a range of general "
+      "(non-separable) kernel sizes on the source and report the crossover")(
+      "bank", po::bool_switch(&bank),
+      "apply kernel types 0 to 3 in a single pass over the source and emit "
+      "all four outputs (the destination filename gets a _k<type> suffix "
+      "per kernel)")(
+      "gaussian-accuracy", po::bool_switch(&gaussian_accuracy),
+      "compare the recursive Gaussian with a sampled Gaussian kernel for a "
+      "range of sigma values on the source and report error and timing");
 
   po::positional_options_description positional_options;
   positional_options.add("source-filename", -1);
@@ -64,52 +165,28 @@ int main(int argc, char* argv[]) {
   int delta;
 
   cv::Mat kernel;
-  switch (kernel_type) {
-    case 0:
-      kernel.create(3, 3, CV_32FC1);
-      kernel = 1;
-      kernel /= 9;
-      ddepth = CV_8UC3;
-      delta = 0;
-      break;
-
-    case 1:
-      kernel.create(5, 5, CV_32FC1);
-      kernel = 1;
-      kernel /= 25;
-      ddepth = CV_8UC3;
-      delta = 0;
-      break;
-
-    case 2:
-      kernel.create(3, 3, CV_32FC1);
-      kernel = -1;
-      kernel.at<float>(0, 0) = 0;
-      kernel.at<float>(2, 0) = 0;
-      kernel.at<float>(1, 1) = 5;
-      kernel.at<float>(0, 2) = 0;
-      kernel.at<float>(2, 2) = 0;
-      kernel /= 1;
-      ddepth = CV_8UC3;
-      delta = 0;
-      break;
-
-    case 3:
-      kernel.create(3, 3, CV_32FC1);
-      kernel = -1;
-      kernel.at<float>(0, 0) = 0;
-      kernel.at<float>(2, 0) = 0;
-      kernel.at<float>(1, 1) = 4;
-      kernel.at<float>(0, 2) = 0;
-      kernel.at<float>(2, 2) = 0;
-      kernel /= 1;
-      ddepth = CV_8UC3;
-      delta = 128;
-      break;
-
-    default:
-      cerr << "*** ERROR *** Invalid kernel type specified" << endl;
+  if (kernel_type == 4 && box_size <= 0) {
+    cerr << "*** ERROR *** Invalid box size specified" << endl;
+    return EXIT_FAILURE;
+  }
+  if (kernel_type == 6) {
+    if (median_radius < 1 || median_radius > 127) {
+      cerr << "*** ERROR *** Invalid median radius specified (1 to 127)"
+           << endl;
       return EXIT_FAILURE;
+    }
+    ddepth = CV_8UC3;
+    delta = 0;
+  } else if (kernel_type == 5) {
+    if (sigma < 0.5) {
+      cerr << "*** ERROR *** Invalid sigma specified (at least 0.5)" << endl;
+      return EXIT_FAILURE;
+    }
+    ddepth = CV_8UC3;
+    delta = 0;
+  } else if (!MakeKernel(kernel_type, box_size, kernel, ddepth, delta)) {
+    cerr << "*** ERROR *** Invalid kernel type specified" << endl;
+    return EXIT_FAILURE;
   }
 
   cv::Point anchor;
@@ -136,8 +213,15 @@ int main(int argc, char* argv[]) {
     cout << "Source filename: " << src_filename << endl;
     cout << "Size: " << src.size() << endl;
     cout << "Channels: " << src.channels() << endl;
-    cout << "Kernel: " << endl;
-    cout << kernel << endl;
+    if (kernel_type == 5) {
+      cout << "Kernel: recursive Gaussian (sigma = " << sigma << ")" << endl;
+    } else if (kernel_type == 6) {
+      cout << "Kernel: median (radius = " << median_radius
+           << ", strips = " << strips << ")" << endl;
+    } else {
+      cout << "Kernel: " << endl;
+      cout << kernel << endl;
+    }
     cout << "Destination filename: " << dst_filename << endl;
     cout << "Data type (ddepth): " << CV_MAT_DEPTH(ddepth) << endl;
     cout << "Border type: "
@@ -150,18 +234,126 @@ int main(int argc, char* argv[]) {
          << endl;
   }
 
+  if (benchmark) {
+    const int default_crossover = ipcv::GetFilter2DFFTCrossover();
+    int crossover = 0;
+
+    cout << "Kernel  Spatial [s]  FFT [s]" << endl;
+    for (const int size : {3, 5, 7, 9, 11, 15, 19, 23, 31, 41}) {
+      cv::Mat random_kernel(size, size, CV_32FC1);
+      cv::randu(random_kernel, -1.0, 1.0);
+      random_kernel /= size * size;
+
+      cv::Mat dst;
+      double seconds[2];
+      for (const int path : {0, 1}) {
+        ipcv::SetFilter2DFFTCrossover(path == 0 ? INT_MAX : 0);
+        auto start_time = chrono::steady_clock::now();
+        ipcv::Filter2D(src, dst, ddepth, random_kernel, anchor, delta,
+                       border_type, border_value);
+        seconds[path] = chrono::duration<double>(chrono::steady_clock::now() -
+                                                 start_time)
+                            .count();
+      }
+
+      cout << size << "x" << size << "  " << seconds[0] << "  " << seconds[1]
+           << endl;
+      if (crossover == 0 && seconds[1] < seconds[0]) {
+        crossover = size * size;
+      }
+    }
+    ipcv::SetFilter2DFFTCrossover(default_crossover);
+
+    if (crossover == 0) {
+      cout << "Measured crossover: above 41x41" << endl;
+    } else {
+      cout << "Measured crossover: " << crossover
+           << " multiply-adds per sample (default is " << default_crossover
+           << ")" << endl;
+    }
+    return EXIT_SUCCESS;
+  }
+
+  if (gaussian_accuracy) {
+    cout << "Sigma  Max error  RMS error  Recursive [s]  Sampled [s]" << endl;
+    for (const double accuracy_sigma : {0.5, 1.0, 2.0, 3.0, 5.0, 10.0, 20.0}) {
+      ipcv::GaussianAccuracy accuracy;
+      if (!ipcv::GaussianBlurAccuracy(src, accuracy_sigma, accuracy)) {
+        cerr << "*** ERROR *** Gaussian accuracy could not be measured"
+             << endl;
+        return EXIT_FAILURE;
+      }
+      cout << accuracy.sigma << "  " << accuracy.max_error << "  "
+           << accuracy.rms_error << "  " << accuracy.recursive_seconds << "  "
+           << accuracy.sampled_seconds << endl;
+    }
+    return EXIT_SUCCESS;
+  }
+
+  if (bank) {
+    const int bank_types[] = {0, 1, 2, 3};
+    vector<cv::Mat> bank_kernels;
+    vector<int> bank_deltas;
+    for (const int type : bank_types) {
+      cv::Mat bank_kernel;
+      int bank_ddepth, bank_delta;
+      MakeKernel(type, box_size, bank_kernel, bank_ddepth, bank_delta);
+      bank_kernels.push_back(bank_kernel);
+      bank_deltas.push_back(bank_delta);
+    }
+
+    vector<cv::Mat> bank_dst;
+    auto start_time = chrono::steady_clock::now();
+    ipcv::Filter2DBank(src, bank_dst, ddepth, bank_kernels, bank_deltas,
+                       border_type, border_value);
+    auto end_time = chrono::steady_clock::now();
+
+    if (verbose) {
+      cout << "Elapsed time: "
+           << chrono::duration<double>(end_time - start_time).count() << " [s]"
+           << endl;
+    }
+
+    boost::filesystem::path dst_path(dst_filename);
+    for (size_t k = 0; k < bank_dst.size(); k++) {
+      const string suffix = "_k" + to_string(bank_types[k]);
+      if (dst_filename.empty()) {
+        cv::imshow(src_filename + " [Filtered" + suffix + "]", bank_dst[k]);
+      } else {
+        cv::imwrite((dst_path.parent_path() /
+                     (dst_path.stem().string() + suffix +
+                      dst_path.extension().string()))
+                        .string(),
+                    bank_dst[k]);
+      }
+    }
+    if (dst_filename.empty()) {
+      cv::imshow(src_filename, src);
+      cv::waitKey(0);
+    }
+
+    return EXIT_SUCCESS;
+  }
+
   cv::Mat dst;
-  clock_t startTime = clock();
+  auto startTime = chrono::steady_clock::now();
 
-  ipcv::Filter2D(src, dst, ddepth, kernel, anchor, delta, border_type,
-                 border_value);
+  if (kernel_type == 5) {
+    ipcv::GaussianBlur(src, dst, ddepth, sigma, border_type, border_value);
+  } else if (kernel_type == 6) {
+    ipcv::MedianFilter(src, dst, median_radius, border_type, border_value,
+                       strips);
+  } else {
+    ipcv::Filter2D(src, dst, ddepth, kernel, anchor, delta, border_type,
+                   border_value);
+  }
 
-  clock_t endTime = clock();
+  auto endTime = chrono::steady_clock::now();
 
   if (verbose) {
     cout << "Elapsed time: "
-         << (endTime - startTime) / static_cast<double>(CLOCKS_PER_SEC)
-         << " [s]" << endl;
+         << chrono::duration<double>(endTime - startTime).count() << " [s]"
+         << endl;
   }
 
   if (dst_filename.empty()) {